@@ -41,6 +41,16 @@ properties (Nontunable)
     %   System object for more details about how fc is defined. The default
     %   value of this property is 0.001.
     MaximumDopplerShift = [10, 20; 20 30; 30 40];
+    %UseNativeFading Use the compiled fading engine
+    %   Set this property to true to run every link through the compiled
+    %   fading engine in networkFading.c instead of comm.RayleighChannel.
+    %   The engine precomputes the fractional-delay filter of each path at
+    %   setup and applies it with SIMD multiply-accumulate. Its Doppler
+    %   generator is statistically equivalent to comm.RayleighChannel but
+    %   not sample-identical. The engine is only used in generated code;
+    %   interpreted execution always uses comm.RayleighChannel. The default
+    %   value of this property is false.
+    UseNativeFading = false;
 end
 
 properties(Constant, Hidden)
@@ -54,6 +64,11 @@ end
 
 properties (Access = private)
     pChannels
+    pFadingIDs
+end
+
+properties (Access = private, Nontunable)
+    pUseNativeFading = false
 end
 
 methods
@@ -92,6 +107,20 @@ methods(Access = protected)
     end
     
     obj.pNumNodes = numNodes;    
+    obj.pUseNativeFading = obj.UseNativeFading && ~coder.target('MATLAB');
+    if obj.pUseNativeFading
+        % One engine link per (tx, rx) pair, its filters built here once
+        obj.pFadingIDs = zeros(numNodes, numNodes - 1, 'int32');
+        for i = 1:numNodes
+            for j = 1:numNodes - 1
+                obj.pFadingIDs(i, j) = NetworkFadingEngine.create( ...
+                    obj.PathDelays{i, j}, obj.AveragePathGains{i, j}, ...
+                    obj.MaximumDopplerShift(i, j), Rs(i), 73);
+            end
+        end
+        return;
+    end
+
     obj.pChannels = cell(obj.pNumNodes, obj.pNumNodes - 1);
     for i = coder.unroll(1:numNodes)
         for j = coder.unroll(1:numNodes - 1)
@@ -108,6 +137,13 @@ methods(Access = protected)
   end
   
   function resetImpl(obj)    
+    if obj.pUseNativeFading
+        for i = 1:numel(obj.pFadingIDs)
+            NetworkFadingEngine.reset(obj.pFadingIDs(i));
+        end
+        return;
+    end
+
     for i = 1:numel(obj.pChannels)
         obj.pChannels{i}.reset;
     end
@@ -116,6 +152,26 @@ methods(Access = protected)
   function y = stepImpl(obj, x)
     numNodes = obj.pNumNodes;
     y = complex(zeros(size(x)));
+    if obj.pUseNativeFading
+        % The engine accumulates each link into the receiver column
+        % directly, so no per-link output is materialized.
+        xc = complex(x);
+        for rx = 1:numNodes
+            yc = y(:, rx);
+            for tx = 1:numNodes
+                if tx < rx
+                    yc = NetworkFadingEngine.step( ...
+                        obj.pFadingIDs(tx, rx-1), xc(:, tx), yc);
+                elseif tx > rx
+                    yc = NetworkFadingEngine.step( ...
+                        obj.pFadingIDs(tx, rx), xc(:, tx), yc);
+                end
+            end
+            y(:, rx) = yc;
+        end
+        return;
+    end
+
     for rx = coder.unroll(1:numNodes)
         for tx = coder.unroll(1:numNodes)
             if tx < rx
@@ -132,6 +188,13 @@ methods(Access = protected)
   end
   
   function releaseImpl(obj)
+    if obj.pUseNativeFading
+        for i = 1:numel(obj.pFadingIDs)
+            NetworkFadingEngine.release(obj.pFadingIDs(i));
+        end
+        return;
+    end
+
     for i = 1:numel(obj.pChannels)
         obj.pChannels{i}.release;
     end
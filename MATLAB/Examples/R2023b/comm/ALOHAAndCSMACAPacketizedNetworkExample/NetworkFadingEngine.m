@@ -0,0 +1,62 @@
+classdef NetworkFadingEngine < coder.ExternalDependency
+%NetworkFadingEngine Compiled multipath fading engine for NetworkChannel
+%   NetworkFadingEngine wraps networkFading.c for use from generated code.
+%   Each link is created once with its path delays, average path gains,
+%   maximum Doppler shift and sample rate. The returned int32 handle is
+%   then stepped, reset and released.
+%
+%   The engine runs only in generated code (Simulink code generation or
+%   MATLAB Coder). NetworkChannel keeps comm.RayleighChannel for
+%   interpreted execution.
+%
+%   See also NetworkChannel, comm.RayleighChannel.
+
+methods (Static)
+  function name = getDescriptiveName(~)
+    name = 'NetworkFadingEngine';
+  end
+
+  function tf = isSupportedContext(~)
+    tf = true;
+  end
+
+  function updateBuildInfo(buildInfo, ~)
+    srcDir = fileparts(mfilename('fullpath'));
+    buildInfo.addIncludePaths(srcDir);
+    buildInfo.addIncludeFiles('networkFading.h', srcDir);
+    buildInfo.addSourceFiles('networkFading.c', srcDir);
+  end
+
+  function id = create(pathDelays, averagePathGains, maximumDopplerShift, ...
+      sampleRate, seed)
+    coder.cinclude('networkFading.h');
+    id = int32(-1);
+    id = coder.ceval('networkFadingCreate', coder.rref(pathDelays), ...
+        coder.rref(averagePathGains), int32(numel(pathDelays)), ...
+        double(maximumDopplerShift), double(sampleRate), uint32(seed));
+    if id < 0
+        error('NetworkChannel:NativeFadingUnsupported', ...
+            ['The native fading engine supports up to 8 paths, delays ' ...
+            'up to 252 samples and 64 links.']);
+    end
+  end
+
+  function y = step(id, x, y)
+    %step Add the faded version of column x to column y
+    coder.cinclude('networkFading.h');
+    coder.ceval('networkFadingStep', id, coder.rref(x), coder.ref(y), ...
+        int32(size(x, 1)), true);
+  end
+
+  function reset(id)
+    coder.cinclude('networkFading.h');
+    coder.ceval('networkFadingReset', id);
+  end
+
+  function release(id)
+    coder.cinclude('networkFading.h');
+    coder.ceval('networkFadingRelease', id);
+  end
+end
+
+end
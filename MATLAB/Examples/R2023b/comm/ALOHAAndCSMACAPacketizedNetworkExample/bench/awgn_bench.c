@@ -0,0 +1,1010 @@
+/*
+ * awgn_bench.c
+ *
+ * Standalone microbenchmark for the generated AWGN Channel S-function
+ * (slprj/_cprj/m_6ZqTk0OKN5QuhEtSrZC29B.c). The module translation unit is
+ * included directly so that its static kernels can be called, together with
+ * the cgxe dispatcher whose batch entry point the check drives. It is linked
+ * against the stub Simulink, MEX and MATLAB Coder runtime in stubs/.
+ *
+ *   awgn_bench check      compare every kernel with awgn_bench_ref.h
+ *   awgn_bench run [N]    time every kernel over N deviates (default 2^22)
+ *   awgn_bench reference  print a new awgn_bench_ref.h to stdout
+ *
+ * The run also times the NetworkChannel fading engine (networkFading.c) on
+ * the example's 5-path frequency-selective link, and the full channel path
+ * (fading of all six links plus AWGN) both as two stages and fused.
+ *
+ * The reference vectors were produced with glibc libm on x86-64. The polar,
+ * inversion and Philox transforms call log, sin and cos, so another libm can
+ * differ in the last bit.
+ */
+
+/* Include files */
+#include "m_6ZqTk0OKN5QuhEtSrZC29B.c"
+#include "PacketizedNetworkSimulinkExample_cgxe.c"
+#include "awgn_bench_ref.h"
+#include "networkFading.h"
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+
+#define AWGN_BENCH_HAVE_TSC
+#endif
+
+/* Type Definitions */
+typedef struct {
+  SimStruct S;
+  creal_T *u0;
+  creal_T *y0;
+  real_T EbNo[3];
+  real_T SignalPower;
+  real_T Generator;
+  real_T Seed;
+  real_T InstanceID;
+} benchBlock;
+
+typedef void (*benchKernelFcn)(coder_internal_RandStream *s, real_T r[],
+  int32_T n);
+
+/* Variable Definitions */
+static const emlrtStack benchRootStack = { NULL,/* site */
+  NULL,                                /* tls */
+  NULL                                 /* prev */
+};
+
+static int32_T benchFailures = 0;
+
+/* Function Definitions */
+static uint64_T benchNowNs(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_T)ts.tv_sec * 1000000000UL + (uint64_T)ts.tv_nsec;
+}
+
+static uint64_T benchCycles(void)
+{
+#ifdef AWGN_BENCH_HAVE_TSC
+
+  return (uint64_T)__rdtsc();
+
+#else
+
+  return 0UL;
+
+#endif
+}
+
+static void benchInitStream(coder_internal_RandStream *s)
+{
+  static const uint32_T seed[2] = { 67U, 0U };
+
+  /* Same state as a freshly set up block with the default seed. */
+  memset(s, 0, sizeof(coder_internal_RandStream));
+  s->MtGenerator.Seed = seed[0];
+  mt19937ar_seedState(s->MtGenerator.State, seed);
+  s->Generator = &s->MtGenerator;
+  s->NtMethod = coder_internal_RngNt_ziggurat;
+  s->PhiloxKey[0] = seed[0];
+  s->PhiloxKey[1] = seed[1];
+}
+
+static void benchUint32Kernel(coder_internal_RandStream *s, real_T r[], int32_T
+  n)
+{
+  uint32_T u[2];
+  int32_T k;
+  for (k = 0; k + 1 < n; k += 2) {
+    mt19937ar_genrand_uint32_vector(s->Generator, u);
+    r[k] = (real_T)u[0];
+    r[k + 1] = (real_T)u[1];
+  }
+}
+
+static void benchZigguratKernel(coder_internal_RandStream *s, real_T r[],
+  int32_T n)
+{
+  int32_T k;
+  for (k = 0; k < n; k++) {
+    r[k] = mt19937ar_mtziggurat(&benchRootStack, s->Generator);
+  }
+}
+
+static void benchZigguratBlockKernel(coder_internal_RandStream *s, real_T r[],
+  int32_T n)
+{
+  RandStream_zigguratGenrandnBlock(&benchRootStack, s, r, n);
+}
+
+static void benchPolarKernel(coder_internal_RandStream *s, real_T r[], int32_T n)
+{
+  RandStream_polarGenrandnBlock(&benchRootStack, s, r, n);
+}
+
+static void benchInversionKernel(coder_internal_RandStream *s, real_T r[],
+  int32_T n)
+{
+  RandStream_inversionGenrandnBlock(&benchRootStack, s, r, n);
+}
+
+static void benchPhiloxKernel(coder_internal_RandStream *s, real_T r[], int32_T
+  n)
+{
+  RandStream_philoxGenrandnBlock(&benchRootStack, s, r, n);
+}
+
+static void benchBlockInit(benchBlock *b, int32_T frameLength, real_T
+  generator, real_T seed, real_T instanceID, int_T numParams)
+{
+  int32_T k;
+  memset(b, 0, sizeof(benchBlock));
+  b->u0 = (creal_T *)calloc((size_t)(3 * frameLength), sizeof(creal_T));
+  b->y0 = (creal_T *)calloc((size_t)(3 * frameLength), sizeof(creal_T));
+  for (k = 0; k < 3 * frameLength; k++) {
+    b->u0[k].re = (real_T)k * 0.25;
+    b->u0[k].im = (real_T)k * -0.5;
+  }
+
+  b->EbNo[0] = 10.0;
+  b->EbNo[1] = 5.0;
+  b->EbNo[2] = 0.0;
+  b->SignalPower = 1.0;
+  b->Generator = generator;
+  b->Seed = seed;
+  b->InstanceID = instanceID;
+  b->S.inputs[0] = b->u0;
+  b->S.outputs[0] = b->y0;
+  b->S.inputWidth[0] = 3 * frameLength;
+  b->S.numInputPorts = 1;
+  b->S.params[0] = b->EbNo;
+  b->S.params[1] = &b->SignalPower;
+  b->S.params[2] = &b->Generator;
+  b->S.params[3] = &b->Seed;
+  b->S.params[4] = &b->InstanceID;
+  b->S.numParams = numParams;
+}
+
+static void benchBlockLaunch(benchBlock *b)
+{
+  method_dispatcher_6ZqTk0OKN5QuhEtSrZC29B(&b->S, SS_CALL_MDL_START, NULL);
+  mdlInitialize_6ZqTk0OKN5QuhEtSrZC29B(&b->S);
+}
+
+static void benchBlockStartWith(benchBlock *b, int32_T frameLength, real_T
+  generator, real_T seed, real_T instanceID, int_T numParams)
+{
+  benchBlockInit(b, frameLength, generator, seed, instanceID, numParams);
+  benchBlockLaunch(b);
+}
+
+static void benchBlockStart(benchBlock *b, int32_T frameLength, real_T
+  generator)
+{
+  benchBlockStartWith(b, frameLength, generator, 67.0, 0.0, 5);
+}
+
+static void benchBlockTerminate(benchBlock *b)
+{
+  mdlTerminate_6ZqTk0OKN5QuhEtSrZC29B(&b->S);
+  free(b->u0);
+  free(b->y0);
+}
+
+static uint64_T benchHash(uint64_T h, const void *data, size_t n)
+{
+  const uchar_T *p;
+  size_t k;
+
+  /* FNV-1a */
+  p = (const uchar_T *)data;
+  for (k = 0; k < n; k++) {
+    h = (h ^ (uint64_T)p[k]) * 1099511628211UL;
+  }
+
+  return h;
+}
+
+static uint64_T benchStepHash(real_T generator)
+{
+  benchBlock b;
+  uint64_T h;
+  int32_T s;
+  h = 14695981039346656037UL;
+  benchBlockStart(&b, 4, generator);
+  for (s = 0; s < 10000; s++) {
+    mdlOutputs_6ZqTk0OKN5QuhEtSrZC29B(&b.S, 0);
+    h = benchHash(h, b.y0, 12U * sizeof(creal_T));
+  }
+
+  benchBlockTerminate(&b);
+  return h;
+}
+
+static void benchFirstSteps(real_T y[24])
+{
+  benchBlock b;
+  int32_T k;
+  int32_T s;
+  benchBlockStart(&b, 1, 0.0);
+  for (s = 0; s < 4; s++) {
+    mdlOutputs_6ZqTk0OKN5QuhEtSrZC29B(&b.S, 0);
+    for (k = 0; k < 3; k++) {
+      y[6 * s + 2 * k] = b.y0[k].re;
+      y[(6 * s + 2 * k) + 1] = b.y0[k].im;
+    }
+  }
+
+  benchBlockTerminate(&b);
+}
+
+static void benchCreateLinks(int32_T linkIds[6])
+{
+  static const real_T pathDelays3[3] = { 0.0, 0.001, 0.002 };
+
+  static const real_T pathDelays5[5] = { 0.0, 0.0032, 0.0036, 0.0053, 0.0096 };
+
+  static const real_T pathGains[5] = { 0.0, 0.0, 0.0, 0.0, 0.0 };
+
+  static const real_T maxDoppler[6] = { 10.0, 20.0, 30.0, 20.0, 30.0, 40.0 };
+
+  static const real_T sampleRate[3] = { 1000.0, 2000.0, 3000.0 };
+
+  int32_T tx;
+
+  /* NetworkChannel defaults: column 1 of the 3-by-2 link grid is the */
+  /* 3-path profile, column 2 the 5-path profile. */
+  for (tx = 0; tx < 3; tx++) {
+    linkIds[tx] = networkFadingCreate(pathDelays3, pathGains, 3, maxDoppler[tx],
+      sampleRate[tx], 73U);
+    linkIds[tx + 3] = networkFadingCreate(pathDelays5, pathGains, 5,
+      maxDoppler[tx + 3], sampleRate[tx], 73U);
+  }
+}
+
+static void benchReleaseLinks(const int32_T linkIds[6])
+{
+  int32_T k;
+  for (k = 0; k < 6; k++) {
+    networkFadingRelease(linkIds[k]);
+  }
+}
+
+static void benchFadeFrame(const int32_T linkIds[6], const creal_T x[], creal_T
+  y[], int32_T frameLength)
+{
+  int32_T rx;
+  int32_T tx;
+
+  /* NetworkChannel stepImpl: each receiver column sums the links from */
+  /* the other two nodes. */
+  memset(y, 0, (size_t)(3 * frameLength) * sizeof(creal_T));
+  for (rx = 0; rx < 3; rx++) {
+    for (tx = 0; tx < 3; tx++) {
+      if (tx < rx) {
+        networkFadingStep(linkIds[tx + 3 * (rx - 1)], &x[tx * frameLength],
+                          &y[rx * frameLength], frameLength, true);
+      } else if (tx > rx) {
+        networkFadingStep(linkIds[tx + 3 * rx], &x[tx * frameLength],
+                          &y[rx * frameLength], frameLength, true);
+      }
+    }
+  }
+}
+
+static void benchCheckFused(void)
+{
+  benchBlock a;
+  benchBlock b;
+  creal_T x[900];
+  int32_T linksA[6];
+  int32_T linksB[6];
+  int32_T f;
+  int32_T k;
+
+  /* Fading then AWGN as two stages, against the fused kernel, on a */
+  /* 300-sample frame so that the 256-sample chunking is exercised. */
+  benchCreateLinks(linksA);
+  benchCreateLinks(linksB);
+  benchBlockStart(&a, 300, 0.0);
+  benchBlockStart(&b, 300, 0.0);
+  for (f = 0; f < 8; f++) {
+    for (k = 0; k < 900; k++) {
+      x[k].re = (real_T)((k * 7 + f) % 11) - 5.0;
+      x[k].im = (real_T)((k * 3 + f) % 7) - 3.0;
+    }
+
+    benchFadeFrame(linksA, x, a.u0, 300);
+    mdlOutputs_6ZqTk0OKN5QuhEtSrZC29B(&a.S, 0);
+    fused_outputs_6ZqTk0OKN5QuhEtSrZC29B(&b.S, x, linksB);
+    if (memcmp(a.y0, b.y0, 900U * sizeof(creal_T)) != 0) {
+      printf("FAIL %-28s frame %d\n", "fused fading + AWGN", (int)f);
+      benchFailures++;
+      break;
+    }
+  }
+
+  if (f == 8) {
+    printf("ok   %s\n", "fused fading + AWGN");
+  }
+
+  benchBlockTerminate(&a);
+  benchBlockTerminate(&b);
+  benchReleaseLinks(linksA);
+  benchReleaseLinks(linksB);
+}
+
+static void benchCheckBatch(void)
+{
+  benchBlock *a;
+  benchBlock *b;
+  SimStruct *S[70];
+  uint32_T count;
+  int32_T f;
+  int32_T k;
+  boolean_T ok;
+
+  /* The cgxe batch entry point, and through it outputs_batch, on 70 */
+  /* blocks, so that the 64-instance chunking is exercised, against */
+  /* mdlOutputs on each block in order. The blocks mix both generators and */
+  /* two frame lengths, and some change their Eb/No between frames to take */
+  /* the non-steady path. */
+  a = (benchBlock *)calloc(70U, sizeof(benchBlock));
+  b = (benchBlock *)calloc(70U, sizeof(benchBlock));
+  for (k = 0; k < 70; k++) {
+    benchBlockStartWith(&a[k], 1 + 299 * (k % 3 == 0), (real_T)(k & 1),
+                        67.0, (real_T)k, 5);
+    benchBlockStartWith(&b[k], 1 + 299 * (k % 3 == 0), (real_T)(k & 1),
+                        67.0, (real_T)k, 5);
+    S[k] = &b[k].S;
+  }
+
+  ok = true;
+  for (f = 0; (f < 8) && ok; f++) {
+    for (k = 0; k < 70; k++) {
+      if ((k % 5 == 0) && (f % 3 == 2)) {
+        a[k].EbNo[0] += 1.0;
+        b[k].EbNo[0] += 1.0;
+      }
+
+      mdlOutputs_6ZqTk0OKN5QuhEtSrZC29B(&a[k].S, 0);
+    }
+
+    count = cgxe_PacketizedNetworkSimulinkExample_batch_outputs(S, 70);
+    if (count != 70U) {
+      printf("FAIL %-28s frame %d: %u blocks stepped\n", "outputs_batch",
+             (int)f, (unsigned int)count);
+      benchFailures++;
+      ok = false;
+    }
+
+    for (k = 0; (k < 70) && ok; k++) {
+      if (memcmp(a[k].y0, b[k].y0, (size_t)a[k].S.inputWidth[0] * sizeof
+                 (creal_T)) != 0) {
+        printf("FAIL %-28s frame %d block %d\n", "outputs_batch", (int)f,
+               (int)k);
+        benchFailures++;
+        ok = false;
+      }
+    }
+  }
+
+  if (ok) {
+    printf("ok   %s\n", "outputs_batch");
+  }
+
+  for (k = 0; k < 70; k++) {
+    benchBlockTerminate(&a[k]);
+    benchBlockTerminate(&b[k]);
+  }
+
+  free(a);
+  free(b);
+}
+
+static void benchCheckInstanceID(void)
+{
+  static const real_T ids[3] = { 1.073741823E+9, 1.073741824E+9, 2.5 };
+
+  benchBlock b;
+  int32_T errors;
+  int32_T expected;
+  int32_T k;
+
+  /* philox needs an InstanceID in [0, 2^30): the largest one is accepted, */
+  /* 2^30, a fraction and a missing one raise an error each. */
+  errors = stub_error_count;
+  for (k = 0; k < 3; k++) {
+    benchBlockStartWith(&b, 1, 1.0, 67.0, ids[k], 5);
+    benchBlockTerminate(&b);
+  }
+
+  benchBlockStartWith(&b, 1, 1.0, 67.0, 0.0, 4);
+  benchBlockTerminate(&b);
+  expected = 3;
+  if (stub_error_count - errors != expected) {
+    printf("FAIL %-28s %d errors, expected %d\n", "InstanceID validation",
+           (int)(stub_error_count - errors), (int)expected);
+    benchFailures++;
+  } else {
+    printf("ok   %s\n", "InstanceID validation");
+  }
+
+  stub_error_count = errors;
+}
+
+static void benchCheckGenerator(void)
+{
+  static const real_T generators[4] = { 2.0, 0.5, -1.0, 0.0 };
+
+  benchBlock b;
+  int32_T errors;
+  int32_T expected;
+  int32_T k;
+
+  /* Generator is 0 (mt19937ar) or 1 (philox): any other value raises an */
+  /* error instead of silently selecting mt19937ar, and so does NaN. */
+  errors = stub_error_count;
+  for (k = 0; k < 4; k++) {
+    benchBlockStartWith(&b, 1, generators[k], 67.0, 0.0, 3);
+    benchBlockTerminate(&b);
+  }
+
+  benchBlockStartWith(&b, 1, mxGetNaN(), 67.0, 0.0, 3);
+  benchBlockTerminate(&b);
+  benchBlockStartWith(&b, 1, 1.0, 67.0, 0.0, 5);
+  benchBlockTerminate(&b);
+  expected = 4;
+  if (stub_error_count - errors != expected) {
+    printf("FAIL %-28s %d errors, expected %d\n", "Generator validation",
+           (int)(stub_error_count - errors), (int)expected);
+    benchFailures++;
+  } else {
+    printf("ok   %s\n", "Generator validation");
+  }
+
+  stub_error_count = errors;
+}
+
+static void benchCheckSeed(void)
+{
+  static const real_T seeds[5] = { -1.0, 2.5, 9.007199254740992E+15,
+    9.007199254740991E+15, 0.0 };
+
+  benchBlock b;
+  int32_T errors;
+  int32_T expected;
+  int32_T k;
+
+  /* Seed is an integer in [0, 2^53): a negative or fractional seed and */
+  /* 2^53 raise an error each instead of being cast, and so does NaN. */
+  errors = stub_error_count;
+  for (k = 0; k < 5; k++) {
+    benchBlockStartWith(&b, 1, 0.0, seeds[k], 0.0, 4);
+    benchBlockTerminate(&b);
+  }
+
+  benchBlockStartWith(&b, 1, 0.0, mxGetNaN(), 0.0, 4);
+  benchBlockTerminate(&b);
+  expected = 4;
+  if (stub_error_count - errors != expected) {
+    printf("FAIL %-28s %d errors, expected %d\n", "Seed validation",
+           (int)(stub_error_count - errors), (int)expected);
+    benchFailures++;
+  } else {
+    printf("ok   %s\n", "Seed validation");
+  }
+
+  stub_error_count = errors;
+}
+
+static void benchCheckStdInput(void)
+{
+  static const int_T widths[2] = { 3, 2 };
+
+  benchBlock b;
+  real_T stdIn[3];
+  int32_T errors;
+  int32_T expected;
+  int32_T k;
+
+  /* The optional std input is 1-by-3 and non-negative: a 1-by-2 port */
+  /* raises an error at start, and a negative or NaN value raises one on */
+  /* every step that reads it. */
+  errors = stub_error_count;
+  for (k = 0; k < 2; k++) {
+    stdIn[0] = 0.1;
+    stdIn[1] = 0.2;
+    stdIn[2] = 0.3;
+    benchBlockInit(&b, 4, 0.0, 67.0, 0.0, 5);
+    b.S.inputs[1] = stdIn;
+    b.S.inputWidth[1] = widths[k];
+    b.S.numInputPorts = 2;
+    benchBlockLaunch(&b);
+    mdlOutputs_6ZqTk0OKN5QuhEtSrZC29B(&b.S, 0);
+    stdIn[1] = -0.2;
+    mdlOutputs_6ZqTk0OKN5QuhEtSrZC29B(&b.S, 0);
+    stdIn[1] = mxGetNaN();
+    mdlOutputs_6ZqTk0OKN5QuhEtSrZC29B(&b.S, 0);
+    benchBlockTerminate(&b);
+  }
+
+  expected = 5;
+  if (stub_error_count - errors != expected) {
+    printf("FAIL %-28s %d errors, expected %d\n", "std input validation",
+           (int)(stub_error_count - errors), (int)expected);
+    benchFailures++;
+  } else {
+    printf("ok   %s\n", "std input validation");
+  }
+
+  stub_error_count = errors;
+}
+
+static void benchCheckInputWidth(void)
+{
+  static const int_T widths[4] = { 4, 5, 0, 6 };
+
+  benchBlock b;
+  int32_T errors;
+  int32_T expected;
+  int32_T k;
+
+  /* The input carries frameLength samples for each of the 3 channels, so */
+  /* a width that is not a positive multiple of 3 raises an error instead */
+  /* of dropping the last samples. */
+  errors = stub_error_count;
+  for (k = 0; k < 4; k++) {
+    benchBlockInit(&b, 2, 0.0, 67.0, 0.0, 5);
+    b.S.inputWidth[0] = widths[k];
+    benchBlockLaunch(&b);
+    benchBlockTerminate(&b);
+  }
+
+  expected = 3;
+  if (stub_error_count - errors != expected) {
+    printf("FAIL %-28s %d errors, expected %d\n", "input width validation",
+           (int)(stub_error_count - errors), (int)expected);
+    benchFailures++;
+  } else {
+    printf("ok   %s\n", "input width validation");
+  }
+
+  stub_error_count = errors;
+}
+
+static void benchCheckResetSeed(void)
+{
+  static const real_T seeds[8] = { 0.0, 67.0, 5489.0, 4.294967296E+9,
+    1.2884901888E+10, 4.294972785E+9, 4.294967363E+9, 9.007199254740991E+15 };
+
+  InstanceStruct_6ZqTk0OKN5QuhEtSrZC29B *moduleInstance;
+  benchBlock b;
+  uint32_T expected[625];
+  uint32_T seed[2];
+  creal_T y[2][24];
+  int32_T k;
+  int32_T r;
+  int32_T s;
+  boolean_T ok;
+
+  /* setup and every reset must seed the twister from the same 64-bit */
+  /* seed, including the seeds whose low word is 0 or 5489, so the state */
+  /* after each reset is compared with a fresh initialization of the split */
+  /* seed, and the frames after a second reset with those after the first. */
+  ok = true;
+  for (k = 0; (k < 8) && ok; k++) {
+    seed[1] = (uint32_T)floor(seeds[k] / 4.294967296E+9);
+    seed[0] = (uint32_T)(seeds[k] - (real_T)seed[1] * 4.294967296E+9);
+    mt19937ar_seedState(expected, seed);
+    benchBlockStartWith(&b, 4, 0.0, seeds[k], 0.0, 5);
+    moduleInstance = (InstanceStruct_6ZqTk0OKN5QuhEtSrZC29B *)b.S.instance;
+    for (r = 0; (r < 2) && ok; r++) {
+      if (r > 0) {
+        mdlInitialize_6ZqTk0OKN5QuhEtSrZC29B(&b.S);
+      }
+
+      if (memcmp(moduleInstance->sysobj.pStream.MtGenerator.State, expected,
+                 sizeof(expected)) != 0) {
+        printf("FAIL %-28s seed %.17g, reset %d\n", "reset seeds as setup",
+               seeds[k], (int)r + 1);
+        benchFailures++;
+        ok = false;
+      }
+
+      for (s = 0; s < 2; s++) {
+        mdlOutputs_6ZqTk0OKN5QuhEtSrZC29B(&b.S, 0);
+        memcpy(&y[r][12 * s], b.y0, 12U * sizeof(creal_T));
+      }
+    }
+
+    if (ok && (memcmp(y[0], y[1], sizeof(y[0])) != 0)) {
+      printf("FAIL %-28s seed %.17g, frames differ\n", "reset seeds as setup",
+             seeds[k]);
+      benchFailures++;
+      ok = false;
+    }
+
+    benchBlockTerminate(&b);
+  }
+
+  if (ok) {
+    printf("ok   %s\n", "reset seeds as setup");
+  }
+}
+
+static void benchFill(benchKernelFcn fcn, real_T r[], int32_T n)
+{
+  coder_internal_RandStream s;
+  benchInitStream(&s);
+  fcn(&s, r, n);
+}
+
+static void benchCompare(const char *name, const real_T r[], const real_T ref[],
+  int32_T n)
+{
+  int32_T k;
+  for (k = 0; k < n; k++) {
+    if (memcmp(&r[k], &ref[k], sizeof(real_T)) != 0) {
+      printf("FAIL %-28s element %d: %a, expected %a\n", name, (int)k, r[k],
+             ref[k]);
+      benchFailures++;
+      return;
+    }
+  }
+
+  printf("ok   %s\n", name);
+}
+
+static void benchCompareHash(const char *name, uint64_T h, uint64_T ref)
+{
+  if (h != ref) {
+    printf("FAIL %-28s hash %016lx, expected %016lx\n", name, h, ref);
+    benchFailures++;
+  } else {
+    printf("ok   %s\n", name);
+  }
+}
+
+static void benchCheck(void)
+{
+  real_T r[64];
+  benchFill(&benchUint32Kernel, r, 32);
+  benchCompare("mt19937ar_genrand_uint32", r, benchRefUint32, 32);
+  benchFill(&benchZigguratKernel, r, 64);
+  benchCompare("mt19937ar_mtziggurat", r, benchRefZiggurat, 64);
+  benchFill(&benchZigguratBlockKernel, r, 64);
+  benchCompare("mt19937ar_mtziggurat_block", r, benchRefZiggurat, 64);
+  benchFill(&benchPolarKernel, r, 64);
+  benchCompare("RandStream_polarGenrandn", r, benchRefPolar, 64);
+  benchFill(&benchInversionKernel, r, 64);
+  benchCompare("RandStream_inversionGenrandn", r, benchRefInversion, 64);
+  benchFill(&benchPhiloxKernel, r, 64);
+  benchCompare("RandStream_philoxGenrandn", r, benchRefPhilox, 64);
+  benchFirstSteps(r);
+  benchCompare("step (first frames)", r, benchRefStep, 24);
+  benchCompareHash("step (mt19937ar, 10000)", benchStepHash(0.0),
+                   benchRefStepHash);
+  benchCompareHash("step (philox, 10000)", benchStepHash(1.0),
+                   benchRefStepHashPhilox);
+  benchCheckFused();
+  benchCheckBatch();
+  benchCheckInstanceID();
+  benchCheckGenerator();
+  benchCheckSeed();
+  benchCheckStdInput();
+  benchCheckInputWidth();
+  benchCheckResetSeed();
+  if (stub_error_count != 0) {
+    printf("FAIL %d error() calls\n", (int)stub_error_count);
+    benchFailures++;
+  }
+}
+
+static void benchPrintArray(const char *name, const real_T r[], int32_T n)
+{
+  int32_T k;
+  printf("static const real_T %s[%d] = {", name, (int)n);
+  for (k = 0; k < n; k++) {
+    printf("%s%s%a", k == 0 ? "" : ",", (k % 3) == 0 ? "\n  " : " ", r[k]);
+  }
+
+  printf("\n};\n\n");
+}
+
+static void benchReference(void)
+{
+  real_T r[64];
+  printf("/*\n * awgn_bench_ref.h\n *\n");
+  printf(" * Reference vectors for awgn_bench check, in C99 hex-float form.\n");
+  printf(" * Regenerate with \"awgn_bench reference > awgn_bench_ref.h\" only\n");
+  printf(" * when the random streams are meant to change.\n */\n\n");
+  printf("#ifndef AWGN_BENCH_REF_H\n#define AWGN_BENCH_REF_H\n\n");
+  benchFill(&benchUint32Kernel, r, 32);
+  benchPrintArray("benchRefUint32", r, 32);
+  benchFill(&benchZigguratKernel, r, 64);
+  benchPrintArray("benchRefZiggurat", r, 64);
+  benchFill(&benchPolarKernel, r, 64);
+  benchPrintArray("benchRefPolar", r, 64);
+  benchFill(&benchInversionKernel, r, 64);
+  benchPrintArray("benchRefInversion", r, 64);
+  benchFill(&benchPhiloxKernel, r, 64);
+  benchPrintArray("benchRefPhilox", r, 64);
+  benchFirstSteps(r);
+  benchPrintArray("benchRefStep", r, 24);
+  printf("#define benchRefStepHash               (0x%016lxUL)\n",
+         benchStepHash(0.0));
+  printf("#define benchRefStepHashPhilox         (0x%016lxUL)\n",
+         benchStepHash(1.0));
+  printf("#endif                                 /* AWGN_BENCH_REF_H */\n");
+}
+
+static void benchReport(const char *name, uint64_T ns, uint64_T cycles, real_T
+  samples, real_T deviates)
+{
+  printf("%-32s %10.2f %12.2f", name, (real_T)ns / samples, samples * 1000.0 /
+         (real_T)ns);
+  if (cycles != 0UL) {
+    printf(" %12.2f\n", (real_T)cycles / deviates);
+  } else {
+    printf(" %12s\n", "n/a");
+  }
+}
+
+static void benchTimeKernel(const char *name, benchKernelFcn fcn, real_T r[],
+  int32_T chunk, int32_T total)
+{
+  coder_internal_RandStream s;
+  uint64_T bestCycles;
+  uint64_T bestNs;
+  uint64_T c0;
+  uint64_T ns;
+  uint64_T t0;
+  int32_T done;
+  int32_T rep;
+
+  /* Best of five runs, each over total deviates in chunks of chunk. */
+  benchInitStream(&s);
+  fcn(&s, r, chunk);
+  bestNs = 0UL;
+  bestCycles = 0UL;
+  for (rep = 0; rep < 5; rep++) {
+    t0 = benchNowNs();
+    c0 = benchCycles();
+    for (done = 0; done < total; done += chunk) {
+      fcn(&s, r, chunk);
+    }
+
+    c0 = benchCycles() - c0;
+    ns = benchNowNs() - t0;
+    if ((rep == 0) || (ns < bestNs)) {
+      bestNs = ns;
+      bestCycles = c0;
+    }
+  }
+
+  benchReport(name, bestNs, bestCycles, (real_T)total, (real_T)total);
+}
+
+static void benchTimeStep(const char *name, int32_T frameLength, real_T
+  generator, int32_T total)
+{
+  benchBlock b;
+  uint64_T bestCycles;
+  uint64_T bestNs;
+  uint64_T c0;
+  uint64_T ns;
+  uint64_T t0;
+  int32_T done;
+  int32_T rep;
+  int32_T samplesPerStep;
+
+  /* One step adds noise to 3 * frameLength complex samples, which is two */
+  /* deviates per sample. */
+  samplesPerStep = 3 * frameLength;
+  benchBlockStart(&b, frameLength, generator);
+  mdlOutputs_6ZqTk0OKN5QuhEtSrZC29B(&b.S, 0);
+  bestNs = 0UL;
+  bestCycles = 0UL;
+  for (rep = 0; rep < 5; rep++) {
+    t0 = benchNowNs();
+    c0 = benchCycles();
+    for (done = 0; done < total; done += 2 * samplesPerStep) {
+      mdlOutputs_6ZqTk0OKN5QuhEtSrZC29B(&b.S, 0);
+    }
+
+    c0 = benchCycles() - c0;
+    ns = benchNowNs() - t0;
+    if ((rep == 0) || (ns < bestNs)) {
+      bestNs = ns;
+      bestCycles = c0;
+    }
+  }
+
+  benchBlockTerminate(&b);
+  done = (total + 2 * samplesPerStep - 1) / (2 * samplesPerStep) * (2 *
+    samplesPerStep);
+  benchReport(name, bestNs, bestCycles, (real_T)done / 2.0, (real_T)done);
+}
+
+static void benchTimeFading(const char *name, int32_T total)
+{
+  static const real_T pathDelays[5] = { 0.0, 0.0032, 0.0036, 0.0053, 0.0096 };
+
+  static const real_T pathGains[5] = { 0.0, 0.0, 0.0, 0.0, 0.0 };
+
+  creal_T *x;
+  creal_T *y;
+  uint64_T bestCycles;
+  uint64_T bestNs;
+  uint64_T c0;
+  uint64_T ns;
+  uint64_T t0;
+  int32_T done;
+  int32_T id;
+  int32_T k;
+  int32_T rep;
+
+  /* Samples are filtered 1024 at a time, as one 1024-sample frame of a */
+  /* 3 kHz link. */
+  x = (creal_T *)calloc(1024U, sizeof(creal_T));
+  y = (creal_T *)calloc(1024U, sizeof(creal_T));
+  for (k = 0; k < 1024; k++) {
+    x[k].re = (real_T)(k % 7) - 3.0;
+    x[k].im = (real_T)(k % 5) - 2.0;
+  }
+
+  id = networkFadingCreate(pathDelays, pathGains, 5, 40.0, 3000.0, 73U);
+  bestNs = 0UL;
+  bestCycles = 0UL;
+  for (rep = 0; rep < 5; rep++) {
+    t0 = benchNowNs();
+    c0 = benchCycles();
+    for (done = 0; done < total; done += 1024) {
+      networkFadingStep(id, x, y, 1024, false);
+    }
+
+    c0 = benchCycles() - c0;
+    ns = benchNowNs() - t0;
+    if ((rep == 0) || (ns < bestNs)) {
+      bestNs = ns;
+      bestCycles = c0;
+    }
+  }
+
+  networkFadingRelease(id);
+  free(x);
+  free(y);
+  done = (total + 1023) / 1024 * 1024;
+  benchReport(name, bestNs, bestCycles, (real_T)done, (real_T)done);
+}
+
+static void benchTimeChannel(const char *name, boolean_T fused, int32_T total)
+{
+  benchBlock b;
+  creal_T *x;
+  uint64_T bestCycles;
+  uint64_T bestNs;
+  uint64_T c0;
+  uint64_T ns;
+  uint64_T t0;
+  int32_T done;
+  int32_T k;
+  int32_T linkIds[6];
+  int32_T rep;
+
+  /* One 256-sample frame per node per step: six faded links summed into */
+  /* three receiver columns, then noise. Reported per received sample. */
+  x = (creal_T *)calloc(768U, sizeof(creal_T));
+  for (k = 0; k < 768; k++) {
+    x[k].re = (real_T)(k % 7) - 3.0;
+    x[k].im = (real_T)(k % 5) - 2.0;
+  }
+
+  benchCreateLinks(linkIds);
+  benchBlockStart(&b, 256, 0.0);
+  bestNs = 0UL;
+  bestCycles = 0UL;
+  for (rep = 0; rep < 5; rep++) {
+    t0 = benchNowNs();
+    c0 = benchCycles();
+    for (done = 0; done < total; done += 768) {
+      if (fused) {
+        fused_outputs_6ZqTk0OKN5QuhEtSrZC29B(&b.S, x, linkIds);
+      } else {
+        benchFadeFrame(linkIds, x, b.u0, 256);
+        mdlOutputs_6ZqTk0OKN5QuhEtSrZC29B(&b.S, 0);
+      }
+    }
+
+    c0 = benchCycles() - c0;
+    ns = benchNowNs() - t0;
+    if ((rep == 0) || (ns < bestNs)) {
+      bestNs = ns;
+      bestCycles = c0;
+    }
+  }
+
+  benchBlockTerminate(&b);
+  benchReleaseLinks(linkIds);
+  free(x);
+  done = (total + 767) / 768 * 768;
+  benchReport(name, bestNs, bestCycles, (real_T)done, (real_T)(2 * done));
+}
+
+static void benchRun(int32_T total)
+{
+  real_T *r;
+  r = (real_T *)malloc(4096U * sizeof(real_T));
+#ifdef AWGN_BENCH_HAVE_TSC
+
+  printf("%-32s %10s %12s %12s\n", "kernel", "ns/sample", "Msamples/s",
+         "TSC/deviate");
+
+#else
+
+  printf("%-32s %10s %12s %12s\n", "kernel", "ns/sample", "Msamples/s",
+         "cyc/deviate");
+
+#endif
+
+  benchTimeKernel("mt19937ar_genrand_uint32_vector", &benchUint32Kernel, r, 4096,
+                  total);
+  benchTimeKernel("mt19937ar_mtziggurat", &benchZigguratKernel, r, 4096, total);
+  benchTimeKernel("mt19937ar_mtziggurat_block", &benchZigguratBlockKernel, r,
+                  4096, total);
+  benchTimeKernel("RandStream_polarGenrandn", &benchPolarKernel, r, 4096, total);
+  benchTimeKernel("RandStream_inversionGenrandn", &benchInversionKernel, r, 4096,
+                  total);
+  benchTimeKernel("RandStream_philoxGenrandn", &benchPhiloxKernel, r, 4096,
+                  total);
+  benchTimeStep("step (frame 1, mt19937ar)", 1, 0.0, total);
+  benchTimeStep("step (frame 64, mt19937ar)", 64, 0.0, total);
+  benchTimeStep("step (frame 64, philox)", 64, 1.0, total);
+  benchTimeFading("networkFadingStep (5 paths)", total);
+  benchTimeChannel("channel (fading, then AWGN)", false, total);
+  benchTimeChannel("channel (fused)", true, total);
+  free(r);
+}
+
+int main(int argc, char *argv[])
+{
+  int32_T total;
+  if ((argc > 1) && (strcmp(argv[1], "check") == 0)) {
+    benchCheck();
+    return benchFailures == 0 ? 0 : 1;
+  }
+
+  if ((argc > 1) && (strcmp(argv[1], "reference") == 0)) {
+    benchReference();
+    return 0;
+  }
+
+  if ((argc > 1) && (strcmp(argv[1], "run") != 0)) {
+    fprintf(stderr, "usage: %s [check | run [N] | reference]\n", argv[0]);
+    return 2;
+  }
+
+  total = 4194304;
+  if (argc > 2) {
+    total = (int32_T)atol(argv[2]);
+  }
+
+  if (total < 4096) {
+    total = 4096;
+  }
+
+  /* Stay bit-exact before reporting any timings. */
+  benchCheck();
+  if (benchFailures != 0) {
+    return 1;
+  }
+
+  printf("\n");
+  benchRun(total);
+  return 0;
+}
@@ -0,0 +1,139 @@
+/*
+ * awgn_bench_ref.h
+ *
+ * Reference vectors for awgn_bench check, in C99 hex-float form.
+ * Regenerate with "awgn_bench reference > awgn_bench_ref.h" only
+ * when the random streams are meant to change.
+ */
+
+#ifndef AWGN_BENCH_REF_H
+#define AWGN_BENCH_REF_H
+
+static const real_T benchRefUint32[32] = {
+  0x1.1779d686p+31, 0x1.80baa66ap+31, 0x1.b7bc0d94p+31,
+  0x1.e717bb8ap+31, 0x1.5f2d500ep+31, 0x1.3df4f7b2p+31,
+  0x1.538cce24p+30, 0x1.adfb06b6p+31, 0x1.eb80c46p+27,
+  0x1.94a6282cp+31, 0x1.8b8c6764p+30, 0x1.2ffe1968p+29,
+  0x1.b487e918p+29, 0x1.83242a2ep+31, 0x1.dd7182dp+31,
+  0x1.d66e6b6ap+31, 0x1.72153d46p+31, 0x1.a8949cbcp+31,
+  0x1.802a96cp+27, 0x1.07a013c8p+31, 0x1.a482db3ep+31,
+  0x1.7d35a9b8p+29, 0x1.2f0984dcp+31, 0x1.de885eb4p+30,
+  0x1.021f0884p+30, 0x1.3240495p+29, 0x1.42a376e8p+30,
+  0x1.0f4c6834p+31, 0x1.80b13898p+29, 0x1.28c6146ep+31,
+  0x1.66ba42ep+30, 0x1.fe7a62fcp+31
+};
+
+static const real_T benchRefZiggurat[64] = {
+  0x1.7e3437ca04b6ap-3, 0x1.0354816ddf265p+1, 0x1.4de0507e97724p-1,
+  -0x1.87d33cb62da6p-1, -0x1.e0dc0ae15fbc7p+0, -0x1.9b21821df3c57p-3,
+  -0x1.2c46f5c4c7b6cp+0, 0x1.21159ecdef904p+1, 0x1.0063202dc73a4p+0,
+  -0x1.6a7f22950fbfbp+0, 0x1.3f4c7f8b6bb0fp-1, 0x1.16b8f0080923cp-2,
+  -0x1.c4d89d1f03377p-2, -0x1.2d14b72079963p-1, -0x1.0cae95be03a25p+0,
+  -0x1.2bb4a63d72c0cp+0, -0x1.fc3d98d1ae2cp-1, -0x1.2d6a1ba7a98dap+0,
+  -0x1.7975dd27a6f0cp-3, -0x1.9a95d7586184bp-2, -0x1.c2f00ca79bdd8p+0,
+  0x1.5c3e3ef28bc0ep+0, -0x1.777365edca365p-2, 0x1.c466097c894aep-4,
+  -0x1.09839392b16b6p-1, -0x1.4812dd917da2ap-1, 0x1.428e39cc4266dp-3,
+  0x1.e3b46c639d1ap-2, 0x1.2927ec55f152cp+0, 0x1.018b6ce2b7f78p-3,
+  -0x1.b1bf835455c64p-2, -0x1.df03f0715bafep-1, 0x1.8b915f284d643p+0,
+  -0x1.366e600deb66bp-2, 0x1.c74fa78353bdp-4, 0x1.308e844012979p+1,
+  -0x1.6412c33c16116p-2, 0x1.ce4e675e06378p-1, 0x1.94eee6655b19cp-1,
+  -0x1.56b3e1d864d63p-1, 0x1.20008c36c4cd2p+1, -0x1.9543aa3b124d9p-2,
+  0x1.1c226b30717aep-1, -0x1.3b0d8bac93f44p-1, -0x1.0cf9e1f088779p+0,
+  -0x1.13b1131f68004p+0, -0x1.0940aeb2437e6p+0, 0x1.21822df0b463p+0,
+  -0x1.deee03d83c961p+0, 0x1.cd75d08ce51a7p+0, -0x1.6dcab7dffd161p-2,
+  0x1.5ba2f35d79f04p+0, -0x1.d9b26865b589bp-2, -0x1.79aa06455548fp-4,
+  -0x1.e87e0b821bfc1p-5, 0x1.1429567d0ef33p+0, 0x1.70a92830fa431p-1,
+  -0x1.ba5302cf88fcep+0, 0x1.1e84ed08fdda2p-2, -0x1.9e2b4252e2137p-3,
+  -0x1.bdb3fcdf01fafp-1, -0x1.e9fb4735d9634p-1, -0x1.981afac207c56p-3,
+  0x1.378374176acbfp-1
+};
+
+static const real_T benchRefPolar[64] = {
+  0x1.274e48c8dd5bdp-3, 0x1.20e6d3e898eb4p+0, 0x1.3b25ddb1a5317p+0,
+  -0x1.1d81966f20f63p+0, -0x1.325fcb4c6fdc5p-1, -0x1.3cbd6a5863bcep-3,
+  0x1.38789045a2ffdp+0, 0x1.655e31f05225dp-2, -0x1.1c6e6525e387bp+0,
+  -0x1.a84caa7a639e2p-1, -0x1.17ea85a4bd241p+0, -0x1.0c6fcca379e48p-1,
+  -0x1.af5d8a47b49d6p+0, -0x1.a2a554c42d692p+0, -0x1.31bc8289e8cb4p+1,
+  0x1.6278f8a6a0511p-1, -0x1.0d9b92a3d11c5p+0, -0x1.82420e9f6bc54p-1,
+  0x1.c755dc8120946p-2, 0x1.c89238b280dafp+0, 0x1.0e2d615946b07p-1,
+  0x1.e5dce0fc542ep-4, -0x1.2532bdedad7cp+0, -0x1.b323b83b9bae8p+0,
+  0x1.d0873d49e02a9p-1, -0x1.2b35f0a6b41d2p-1, 0x1.a5d76faacb733p-5,
+  0x1.11a9410b8b3bp-1, -0x1.9ddde331eba68p-1, 0x1.2a0a00426688bp-1,
+  0x1.3f26ab143e6b3p-2, -0x1.5fefc754ddee6p-4, 0x1.e3b7e82124843p-1,
+  -0x1.0836023ad51d8p+0, -0x1.1020856eaf123p+0, -0x1.a6f67359d9209p-1,
+  -0x1.a7effbd0b65a2p-3, 0x1.366d802576e73p-1, -0x1.316be89d8de3fp+1,
+  -0x1.8350f464020d4p-1, -0x1.cc960d05ae616p-4, 0x1.bf71276a0abb8p-1,
+  0x1.631a3ed23d807p-1, -0x1.44a95eccc2598p+0, 0x1.d35163e69c78dp+0,
+  -0x1.7759674bad929p-1, -0x1.b6f69b1afef72p-2, -0x1.15efc7c6b3b11p-1,
+  -0x1.7f9f89b23f74ap-3, 0x1.4c538ef11afcdp+0, 0x1.5e9d990fc7993p-3,
+  -0x1.a00a9c9a985edp+0, -0x1.81929c56872f7p-1, 0x1.ff5859b34da9dp-1,
+  -0x1.5a754c6f8a3c7p+0, -0x1.3f6cc0e84a08p-3, -0x1.48ee15ab50286p-1,
+  -0x1.04520cce0ef88p-1, 0x1.ae0073bf9681ep-2, -0x1.153058e02a6d1p+0,
+  -0x1.159ab5fede0d2p-1, 0x1.27fedad0cbfc4p+0, 0x1.7d80a5bf1893ep-2,
+  -0x1.c91b967955661p-2
+};
+
+static const real_T benchRefInversion[64] = {
+  0x1.d7ce026b971cep-4, 0x1.1340134be6abfp+0, 0x1.efdce0e3e82e7p-2,
+  -0x1.bdf97459b7e8fp-2, -0x1.8e06c807fbc78p+0, -0x1.27f8759a0c9e7p-2,
+  -0x1.9750f58ea8fd4p-1, 0x1.7ea62dcc5ecefp+0, 0x1.2eb6452fe3ce7p-1,
+  -0x1.acfccd0b50c41p+0, 0x1.d73b05be30bdbp-1, 0x1.dbddd023ec22dp-3,
+  -0x1.5602292e12057p-1, -0x1.ed1136990d2c6p-2, -0x1.c5938f21e2c5p-1,
+  -0x1.89af13ad42486p-2, -0x1.4dc1c9331033cp-1, -0x1.24aa3be9f27d3p+1,
+  -0x1.d42e20ee81f7ap-3, -0x1.c624987bef2eep-3, -0x1.b6feb0d20e9b1p+0,
+  0x1.b20baa256d33fp+0, -0x1.0996a8f2a114dp-2, 0x1.30c9c478a23d5p-4,
+  -0x1.759009d637543p-1, -0x1.ffcdce8c9b6d9p-2, 0x1.0b9770ad314fdp-3,
+  0x1.190e42770a6d4p-1, 0x1.add354ace6832p+0, 0x1.088849b013de9p-2,
+  -0x1.faed94107a6fdp-3, -0x1.7cf8fe4f77a9bp-2, 0x1.c96460260eda3p-1,
+  -0x1.0ff8c78e85fc4p-1, 0x1.cb055ae578817p-4, 0x1.c9a22ea7a1f49p+0,
+  -0x1.ce14924b35defp-1, 0x1.36aa358ca0368p-1, 0x1.3ecaeb4e1c753p-1,
+  -0x1.aef94ed0febeep+0, 0x1.dfef9300c0678p+0, -0x1.525813214fc1ep-2,
+  0x1.16c605a7f0637p-1, -0x1.33b20eb1fe2cp-1, -0x1.5ae0ffc0484cep-1,
+  -0x1.0532aeff6bccfp-1, -0x1.15e2c7394dfc8p+0, 0x1.f6413cdb252f9p+0,
+  -0x1.31fd13c2cc8b9p+1, 0x1.402ba3d8ca8b2p+0, -0x1.7ef86e5628e7ap-2,
+  0x1.743d5b7c5c9dbp+0, -0x1.02229474819bp-2, -0x1.4441342bd825cp-4,
+  -0x1.0e9196263c28ap-3, 0x1.54c3efc6c8b8fp+0, 0x1.755a9a97d54e8p-2,
+  -0x1.69f32b2d8860cp-1, 0x1.d4772f2657ebcp-2, -0x1.6d7a7d5e8212dp-3,
+  -0x1.82ab3d66c953fp-1, -0x1.0751dadc530e8p+0, -0x1.ddf8ebeac3086p-4,
+  0x1.d861e86013439p-1
+};
+
+static const real_T benchRefPhilox[64] = {
+  -0x1.39b23dd1aef3ap+1, -0x1.094dc595abbc7p+1, 0x1.0d7dbc335d21ap-1,
+  0x1.8293626caecb1p+0, 0x1.a9c0be23edad7p-3, 0x1.32e2d987177f8p-3,
+  0x1.9c8fed0720708p+0, -0x1.8255e36db9aadp+0, -0x1.ee4072f7520d2p-3,
+  0x1.0cb6cea2f2036p+1, 0x1.6460f1c8dcd83p-1, -0x1.de168331a1607p+0,
+  -0x1.9dc46e2b8bf2bp-5, 0x1.e8c8e773afc2dp-1, -0x1.e92866133994cp-4,
+  0x1.0d85e487676acp+0, -0x1.4f31d76297414p+1, 0x1.21cf15cc5dcbfp-2,
+  -0x1.4c2e8de1fc7dep-4, -0x1.70d63ed3a1e36p+0, -0x1.2e7a8eebcf479p-2,
+  0x1.5a2fc4b217c06p+1, 0x1.8a7a3c7412713p-1, -0x1.685be9eaa75f2p+0,
+  -0x1.5d2ebc5abd8e1p-1, -0x1.b0ff17067d778p+0, -0x1.890f0a59e1b87p-2,
+  0x1.c8dab45c1c17ap-2, -0x1.f2a04d3f4eff5p-3, 0x1.c9abb9f5e75bfp-3,
+  0x1.1bce41cf821ep-6, -0x1.264c6224bb591p-2, 0x1.253c6145ba067p-1,
+  0x1.b113e3aeaaf75p-3, 0x1.6b9c87a1e3669p+0, -0x1.23f8923eeab36p-2,
+  0x1.6807331dd0bc7p-3, 0x1.29992c69d18bp+0, -0x1.b11441cfc35d7p+0,
+  0x1.1d1a748babdf7p-4, -0x1.15621929652bep+0, 0x1.af67db6f45868p+0,
+  0x1.5d43c42539525p+0, 0x1.4760e61b32c1ap-1, -0x1.9aa90580dcf9ep-2,
+  -0x1.1b2f7fec9205ap+0, -0x1.6084f79ad9ff3p-2, 0x1.ad95e50006037p-2,
+  0x1.f1fc790b52e88p-1, -0x1.e433500951f0bp-1, -0x1.22ae2e41e807p+0,
+  -0x1.320d3d1af6ca5p-3, -0x1.23813998c5c01p-1, -0x1.5148102f788cp+0,
+  -0x1.e82f1c469cbfep-2, -0x1.f9fcc5507c191p-7, -0x1.c17811b39c4a6p-2,
+  0x1.e29aebbc8cfb3p-4, 0x1.0483bec58c7a1p+1, -0x1.21b76b2fb3798p+0,
+  0x1.4340576b86fafp+0, 0x1.1ec5d3b73e911p+1, -0x1.8e89a10a6ba61p-2,
+  0x1.a4e336b2a18bdp+0
+};
+
+static const real_T benchRefStep[24] = {
+  0x1.e3743bdaf8e8p-6, 0x1.48078e241cba4p-2, 0x1.bbc09d541a8fap-2,
+  -0x1.6e2b73cc27bfbp-1, -0x1.c1b815c2bf78ep-2, -0x1.19b21821df3c5p+0,
+  -0x1.7bd2ed87baf34p-3, 0x1.6daa872847a02p-2, 0x1.102d57f3d5291p-1,
+  -0x1.cbd8c9e1c7086p-1, 0x1.9fa63fc5b5d88p-1, -0x1.ba51c3fdfdb71p-1,
+  -0x1.1e67b16e58bdap-4, -0x1.7cd730a4cc5f8p-4, -0x1.7174a3ad012a8p-5,
+  -0x1.a88970e5a9a05p-1, 0x1.e1339728ea08p-9, -0x1.96b50dd3d4c6dp+0,
+  -0x1.dd742f1749b0fp-6, -0x1.03ad4cefbfa75p-4, -0x1.f652d76d4ef3ep-3,
+  -0x1.e1590f894502cp-4, 0x1.44464d091ae4ep-2, -0x1.e3b99f68376b5p-1
+};
+
+#define benchRefStepHash               (0xceb42be1017d5cd5UL)
+#define benchRefStepHashPhilox         (0x44cf2de5282c759cUL)
+#endif                                 /* AWGN_BENCH_REF_H */
@@ -0,0 +1,2 @@
+/* Benchmark stub for cgxeooprt.h: nothing from it is used by the */
+/* AWGN module. */
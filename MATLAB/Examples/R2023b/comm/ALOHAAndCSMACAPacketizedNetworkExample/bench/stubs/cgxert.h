@@ -0,0 +1,15 @@
+/* Benchmark stub of the code-generated S-function runtime. */
+#ifndef CGXERT_H
+#define CGXERT_H
+#include "simstruc.h"
+
+extern void *cgxertGetRunTimeParamInfoData(SimStruct *S, int_T idx);
+extern void cgxertSetSimStateCompliance(SimStruct *S, int_T v);
+extern void cgxertSetGcb(SimStruct *S, int_T a, int_T b);
+extern void cgxertRestoreGcb(SimStruct *S, int_T a, int_T b);
+extern void *cgxertGetEMLRTCtx(SimStruct *S);
+extern void *cgxertGetInputPortSignal(SimStruct *S, int_T port);
+extern void *cgxertGetOutputPortSignal(SimStruct *S, int_T port);
+extern void *cgxertGetRuntimeInstance(SimStruct *S);
+extern void cgxertSetRuntimeInstance(SimStruct *S, void *p);
+#endif                                 /* CGXERT_H */
@@ -0,0 +1,2 @@
+/* Benchmark stub for covrt.h: nothing from it is used by the */
+/* AWGN module. */
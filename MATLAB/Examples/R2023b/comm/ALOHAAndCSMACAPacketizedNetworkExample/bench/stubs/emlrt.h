@@ -0,0 +1,58 @@
+/* Benchmark stub of the MATLAB Coder runtime interface. */
+#ifndef EMLRT_H
+#define EMLRT_H
+#include "tmwtypes.h"
+
+#ifndef typedef_mxArray
+#define typedef_mxArray
+
+typedef struct mxArray_tag mxArray;
+
+#endif                                 /* typedef_mxArray */
+
+typedef struct {
+  int32_T lineNo;
+  const char *fcnName;
+  const char *pathName;
+} emlrtRSInfo;
+
+typedef struct {
+  int32_T lineNo;
+  int32_T colNo;
+  const char *fName;
+  const char *pName;
+} emlrtMCInfo;
+
+typedef struct {
+  int32_T lineNo;
+  int32_T colNo;
+  const char *fName;
+  const char *pName;
+} emlrtRTEInfo;
+
+typedef struct emlrtStack {
+  const emlrtRSInfo *site;
+  void *tls;
+  const struct emlrtStack *prev;
+} emlrtStack;
+
+typedef const void *emlrtConstCTX;
+
+extern const mxArray *emlrtCreateCharArray(int32_T ndims, const int32_T *dims);
+extern void emlrtInitCharArrayR2013a(emlrtConstCTX ctx, int32_T n, const
+  mxArray *m, const char_T *s);
+extern void emlrtAssign(const mxArray **dst, const mxArray *src);
+extern const mxArray *emlrtCallMATLABR2012b(emlrtConstCTX ctx, int32_T nlhs,
+  const mxArray **plhs, int32_T nrhs, const mxArray **prhs, const char *name,
+  boolean_T b, emlrtMCInfo *loc);
+extern void emlrtErrorWithMessageIdR2018a(const void *aTLS, const
+  emlrtRTEInfo *aInfo, const char *aMsgID, const char *aReportID, int32_T
+  aArgCount, ...);
+extern void emlrtLicenseCheckR2022a(emlrtConstCTX ctx, const char *id, const
+  char *tb, int32_T x);
+
+/* Number of MATLAB error() and emlrtErrorWithMessageIdR2018a calls the */
+/* module made; the check mode expects zero. */
+extern int32_T stub_error_count;
+
+#endif                                 /* EMLRT_H */
@@ -0,0 +1,22 @@
+/* Benchmark stub of the MathWorks scalar math library, mapped onto libm. */
+#ifndef MWMATHUTIL_H
+#define MWMATHUTIL_H
+#include <math.h>
+
+#define muDoubleScalarIsNaN(x)         isnan(x)
+#define muDoubleScalarIsInf(x)         isinf(x)
+#define muDoubleScalarPower(a, b)      pow(a, b)
+#define muDoubleScalarSqrt(x)          sqrt(x)
+#define muDoubleScalarFloor(x)         floor(x)
+#define muDoubleScalarCeil(x)          ceil(x)
+#define muDoubleScalarRound(x)         round(x)
+#define muDoubleScalarRem(a, b)        fmod(a, b)
+#define muDoubleScalarAbs(x)           fabs(x)
+#define muDoubleScalarExp(x)           exp(x)
+#define muDoubleScalarLog(x)           log(x)
+#define muDoubleScalarLog10(x)         log10(x)
+#define muDoubleScalarSin(x)           sin(x)
+#define muDoubleScalarCos(x)           cos(x)
+#define muDoubleScalarMax(a, b)        fmax(a, b)
+#define muDoubleScalarMin(a, b)        fmin(a, b)
+#endif                                 /* MWMATHUTIL_H */
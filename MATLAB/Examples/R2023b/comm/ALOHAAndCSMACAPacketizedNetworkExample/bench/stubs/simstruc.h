@@ -0,0 +1,78 @@
+/* Benchmark stub of the Simulink S-function interface. Only what the AWGN */
+/* module touches is declared. The SimStruct is a plain struct that the */
+/* benchmark fills in directly. */
+#ifndef SIMSTRUC_H
+#define SIMSTRUC_H
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "tmwtypes.h"
+
+#ifndef typedef_mxArray
+#define typedef_mxArray
+
+typedef struct mxArray_tag mxArray;
+
+#endif                                 /* typedef_mxArray */
+struct SimStruct_tag
+{
+  void *instance;
+  void *inputs[4];
+  void *outputs[4];
+  int_T inputWidth[4];
+  int_T numInputPorts;
+  void *params[8];
+  int_T numParams;
+  uint_T options;
+};
+
+typedef struct SimStruct_tag SimStruct;
+
+#define SS_CALL_MDL_START              (0)
+#define SS_CALL_MDL_PROCESS_PARAMETERS (1)
+#define SS_CALL_MDL_GET_SIM_STATE      (2)
+#define SS_CALL_MDL_SET_SIM_STATE      (3)
+#define SS_OPTION_RUNTIME_EXCEPTION_FREE_CODE (1U)
+
+typedef void (*mdlOutputsFcn)(SimStruct *S, int_T tid);
+typedef void (*mdlVoidFcn)(SimStruct *S);
+typedef void (*mdlUpdateFcn)(SimStruct *S, int_T tid);
+
+/* The benchmark calls the module's mdl* functions directly, so the */
+/* registration calls do nothing. */
+extern void ssSetmdlOutputs(SimStruct *S, mdlOutputsFcn f);
+extern void ssSetmdlInitializeConditions(SimStruct *S, mdlVoidFcn f);
+extern void ssSetmdlUpdate(SimStruct *S, mdlUpdateFcn f);
+extern void ssSetmdlDerivatives(SimStruct *S, mdlVoidFcn f);
+extern void ssSetmdlTerminate(SimStruct *S, mdlVoidFcn f);
+extern void ssSetmdlEnable(SimStruct *S, mdlVoidFcn f);
+extern void ssSetmdlDisable(SimStruct *S, mdlVoidFcn f);
+extern uint_T ssGetOptions(SimStruct *S);
+extern void ssSetOptions(SimStruct *S, uint_T o);
+extern int_T ssGetInputPortWidth(SimStruct *S, int_T port);
+extern int_T ssGetNumInputPorts(SimStruct *S);
+extern int_T ssGetNumRunTimeParams(SimStruct *S);
+extern uint32_T ssGetChecksum0(SimStruct *S);
+extern uint32_T ssGetChecksum1(SimStruct *S);
+extern uint32_T ssGetChecksum2(SimStruct *S);
+extern uint32_T ssGetChecksum3(SimStruct *S);
+
+typedef enum {
+  mxREAL,
+  mxCOMPLEX
+} mxComplexity;
+
+extern int mexPrintf(const char *fmt, ...);
+extern mxArray *mxCreateCellMatrix(size_t m, size_t n);
+extern mxArray *mxCreateString(const char *s);
+extern void mxSetCell(mxArray *c, size_t i, mxArray *v);
+extern mxArray *mxCreateDoubleMatrix(size_t m, size_t n, mxComplexity c);
+extern double *mxGetPr(const mxArray *a);
+extern mxArray *mxCreateStructMatrix(size_t m, size_t n, int nf, const char **f);
+extern void mxSetFieldByNumber(mxArray *s, size_t i, int f, mxArray *v);
+extern double mxGetInf(void);
+extern double mxGetNaN(void);
+extern int mxIsNaN(double x);
+extern int mxIsInf(double x);
+#endif                                 /* SIMSTRUC_H */
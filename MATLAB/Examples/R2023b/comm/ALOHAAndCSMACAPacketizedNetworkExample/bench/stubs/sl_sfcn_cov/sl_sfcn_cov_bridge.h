@@ -0,0 +1,2 @@
+/* Benchmark stub for sl_sfcn_cov_bridge.h: nothing from it is used by the */
+/* AWGN module. */
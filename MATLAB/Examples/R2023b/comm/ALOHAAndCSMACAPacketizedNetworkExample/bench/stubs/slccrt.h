@@ -0,0 +1,2 @@
+/* Benchmark stub for slccrt.h: nothing from it is used by the */
+/* AWGN module. */
@@ -0,0 +1,2 @@
+/* Benchmark stub for slexec_vm_simstruct_bridge.h: nothing from it is used by the */
+/* AWGN module. */
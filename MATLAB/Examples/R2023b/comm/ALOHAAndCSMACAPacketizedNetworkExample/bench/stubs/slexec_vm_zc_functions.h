@@ -0,0 +1,2 @@
+/* Benchmark stub for slexec_vm_zc_functions.h: nothing from it is used by the */
+/* AWGN module. */
@@ -0,0 +1,301 @@
+/* Benchmark stub implementations of the Simulink, MEX, MATLAB Coder and */
+/* cgxe runtime calls that the AWGN module makes. Parameters and ports */
+/* are read straight from the SimStruct fields. Text and MATLAB calls */
+/* are dropped, except that calls to error() and the run-time errors are */
+/* counted. */
+#include <stdarg.h>
+#include "simstruc.h"
+#include "emlrt.h"
+#include "cgxert.h"
+
+struct mxArray_tag
+{
+  int32_T unused;
+};
+
+static mxArray stub_mxArray;
+int32_T stub_error_count = 0;
+
+void ssSetmdlOutputs(SimStruct *S, mdlOutputsFcn f)
+{
+  (void)S;
+  (void)f;
+}
+
+void ssSetmdlInitializeConditions(SimStruct *S, mdlVoidFcn f)
+{
+  (void)S;
+  (void)f;
+}
+
+void ssSetmdlUpdate(SimStruct *S, mdlUpdateFcn f)
+{
+  (void)S;
+  (void)f;
+}
+
+void ssSetmdlDerivatives(SimStruct *S, mdlVoidFcn f)
+{
+  (void)S;
+  (void)f;
+}
+
+void ssSetmdlTerminate(SimStruct *S, mdlVoidFcn f)
+{
+  (void)S;
+  (void)f;
+}
+
+void ssSetmdlEnable(SimStruct *S, mdlVoidFcn f)
+{
+  (void)S;
+  (void)f;
+}
+
+void ssSetmdlDisable(SimStruct *S, mdlVoidFcn f)
+{
+  (void)S;
+  (void)f;
+}
+
+uint_T ssGetOptions(SimStruct *S)
+{
+  return S->options;
+}
+
+void ssSetOptions(SimStruct *S, uint_T o)
+{
+  S->options = o;
+}
+
+int_T ssGetInputPortWidth(SimStruct *S, int_T port)
+{
+  return S->inputWidth[port];
+}
+
+int_T ssGetNumInputPorts(SimStruct *S)
+{
+  return S->numInputPorts;
+}
+
+int_T ssGetNumRunTimeParams(SimStruct *S)
+{
+  return S->numParams;
+}
+
+/* Checksums of the generated module, so that the cgxe dispatcher accepts */
+/* every stub block. */
+uint32_T ssGetChecksum0(SimStruct *S)
+{
+  (void)S;
+  return 3555681173U;
+}
+
+uint32_T ssGetChecksum1(SimStruct *S)
+{
+  (void)S;
+  return 210201439U;
+}
+
+uint32_T ssGetChecksum2(SimStruct *S)
+{
+  (void)S;
+  return 3739409047U;
+}
+
+uint32_T ssGetChecksum3(SimStruct *S)
+{
+  (void)S;
+  return 1544329537U;
+}
+
+int mexPrintf(const char *fmt, ...)
+{
+  va_list args;
+  int n;
+  va_start(args, fmt);
+  n = vprintf(fmt, args);
+  va_end(args);
+  return n;
+}
+
+mxArray *mxCreateCellMatrix(size_t m, size_t n)
+{
+  (void)m;
+  (void)n;
+  return &stub_mxArray;
+}
+
+mxArray *mxCreateString(const char *s)
+{
+  (void)s;
+  return &stub_mxArray;
+}
+
+void mxSetCell(mxArray *c, size_t i, mxArray *v)
+{
+  (void)c;
+  (void)i;
+  (void)v;
+}
+
+mxArray *mxCreateDoubleMatrix(size_t m, size_t n, mxComplexity c)
+{
+  (void)m;
+  (void)n;
+  (void)c;
+  return &stub_mxArray;
+}
+
+double *mxGetPr(const mxArray *a)
+{
+  (void)a;
+  return NULL;
+}
+
+mxArray *mxCreateStructMatrix(size_t m, size_t n, int nf, const char **f)
+{
+  (void)m;
+  (void)n;
+  (void)nf;
+  (void)f;
+  return &stub_mxArray;
+}
+
+void mxSetFieldByNumber(mxArray *s, size_t i, int f, mxArray *v)
+{
+  (void)s;
+  (void)i;
+  (void)f;
+  (void)v;
+}
+
+double mxGetInf(void)
+{
+  return HUGE_VAL;
+}
+
+double mxGetNaN(void)
+{
+  return nan("");
+}
+
+int mxIsNaN(double x)
+{
+  return isnan(x);
+}
+
+int mxIsInf(double x)
+{
+  return isinf(x);
+}
+
+const mxArray *emlrtCreateCharArray(int32_T ndims, const int32_T *dims)
+{
+  (void)ndims;
+  (void)dims;
+  return &stub_mxArray;
+}
+
+void emlrtInitCharArrayR2013a(emlrtConstCTX ctx, int32_T n, const mxArray *m,
+  const char_T *s)
+{
+  (void)ctx;
+  (void)n;
+  (void)m;
+  (void)s;
+}
+
+void emlrtAssign(const mxArray **dst, const mxArray *src)
+{
+  *dst = src;
+}
+
+const mxArray *emlrtCallMATLABR2012b(emlrtConstCTX ctx, int32_T nlhs, const
+  mxArray **plhs, int32_T nrhs, const mxArray **prhs, const char *name,
+  boolean_T b, emlrtMCInfo *loc)
+{
+  (void)ctx;
+  (void)nlhs;
+  (void)plhs;
+  (void)nrhs;
+  (void)prhs;
+  (void)b;
+  (void)loc;
+  if (strcmp(name, "error") == 0) {
+    stub_error_count++;
+  }
+
+  return &stub_mxArray;
+}
+
+void emlrtErrorWithMessageIdR2018a(const void *aTLS, const emlrtRTEInfo *aInfo,
+  const char *aMsgID, const char *aReportID, int32_T aArgCount, ...)
+{
+  (void)aTLS;
+  (void)aInfo;
+  (void)aMsgID;
+  (void)aReportID;
+  (void)aArgCount;
+  stub_error_count++;
+}
+
+void emlrtLicenseCheckR2022a(emlrtConstCTX ctx, const char *id, const char *tb,
+  int32_T x)
+{
+  (void)ctx;
+  (void)id;
+  (void)tb;
+  (void)x;
+}
+
+void *cgxertGetRunTimeParamInfoData(SimStruct *S, int_T idx)
+{
+  return S->params[idx];
+}
+
+void cgxertSetSimStateCompliance(SimStruct *S, int_T v)
+{
+  (void)S;
+  (void)v;
+}
+
+void cgxertSetGcb(SimStruct *S, int_T a, int_T b)
+{
+  (void)S;
+  (void)a;
+  (void)b;
+}
+
+void cgxertRestoreGcb(SimStruct *S, int_T a, int_T b)
+{
+  (void)S;
+  (void)a;
+  (void)b;
+}
+
+void *cgxertGetEMLRTCtx(SimStruct *S)
+{
+  (void)S;
+  return NULL;
+}
+
+void *cgxertGetInputPortSignal(SimStruct *S, int_T port)
+{
+  return S->inputs[port];
+}
+
+void *cgxertGetOutputPortSignal(SimStruct *S, int_T port)
+{
+  return S->outputs[port];
+}
+
+void *cgxertGetRuntimeInstance(SimStruct *S)
+{
+  return S->instance;
+}
+
+void cgxertSetRuntimeInstance(SimStruct *S, void *p)
+{
+  S->instance = p;
+}
@@ -0,0 +1,67 @@
+/* Benchmark stub of the MathWorks fixed-width type definitions. */
+#ifndef TMWTYPES_H
+#define TMWTYPES_H
+#include <stddef.h>
+#include <stdint.h>
+
+typedef int8_t int8_T;
+typedef uint8_t uint8_T;
+typedef int16_t int16_T;
+typedef uint16_t uint16_T;
+typedef int32_t int32_T;
+typedef uint32_t uint32_T;
+typedef float real32_T;
+typedef double real64_T;
+typedef double real_T;
+typedef unsigned char boolean_T;
+typedef char char_T;
+typedef unsigned char uchar_T;
+typedef int int_T;
+typedef unsigned int uint_T;
+typedef unsigned long ulong_T;
+typedef char_T byte_T;
+
+typedef struct {
+  real_T re;
+  real_T im;
+} creal_T;
+
+typedef struct {
+  real32_T re;
+  real32_T im;
+} creal32_T;
+
+typedef struct {
+  int8_T re;
+  int8_T im;
+} cint8_T;
+
+typedef struct {
+  uint8_T re;
+  uint8_T im;
+} cuint8_T;
+
+typedef struct {
+  int16_T re;
+  int16_T im;
+} cint16_T;
+
+typedef struct {
+  uint16_T re;
+  uint16_T im;
+} cuint16_T;
+
+typedef struct {
+  int32_T re;
+  int32_T im;
+} cint32_T;
+
+typedef struct {
+  uint32_T re;
+  uint32_T im;
+} cuint32_T;
+
+#define MAX_uint32_T                   ((uint32_T)(0xFFFFFFFFU))
+#define MIN_int32_T                    ((int32_T)(-2147483647-1))
+#define MAX_int32_T                    ((int32_T)(2147483647))
+#endif                                 /* TMWTYPES_H */
@@ -0,0 +1,63 @@
+function exeFile = buildStandaloneNetwork(paramSets, paramFile)
+%buildStandaloneNetwork Build a standalone executable of the packetized network
+%   EXEFILE = buildStandaloneNetwork() builds PacketizedNetworkSimulinkExample
+%   with the Rapid Simulation (RSim) target and returns the path of the
+%   executable. The NetworkChannel block runs the compiled fading engine
+%   (UseNativeFading) and networkFading.c is linked into the executable
+%   together with the AWGN Channel code, so the executable runs on machines
+%   without MATLAB and without accelerator JIT warm-up. Block parameters
+%   stay tunable so that they can be supplied from a file at run time.
+%
+%   EXEFILE = buildStandaloneNetwork(PARAMSETS, PARAMFILE) also writes the
+%   parameter sets PARAMSETS to the MAT-file PARAMFILE. PARAMSETS is a
+%   struct array; each element is one set and each field the value of a
+%   tunable model workspace or base workspace variable, e.g. a variable
+%   used in the SNRN12, SNRN23 and SNRN31 fields of the channel mask. Run
+%   set K with
+%
+%       !PacketizedNetworkSimulinkExample -p PARAMFILE@K -o outK.mat -tf 10
+%
+%   RSim runs one set per invocation. To run many channel parameter sets in
+%   one process, use the native batch runner in standalone/, which links the
+%   same fading and AWGN code.
+%
+%   See also rsimgetrtp, rsimsetrtpparam, NetworkChannel.
+
+arguments
+    paramSets struct = struct([])
+    paramFile (1,1) string = "networkParamSets.mat"
+end
+
+modelName = 'PacketizedNetworkSimulinkExample';
+load_system(modelName);
+cleanup = onCleanup(@() close_system(modelName, 0));
+
+set_param(modelName, 'SystemTargetFile', 'rsim.tlc');
+set_param(modelName, 'DefaultParameterBehavior', 'Tunable');
+set_param(modelName, 'RSIM_STORAGE_CLASS_AUTO', 'on');
+% The channel is a library link, so it is disabled before the System
+% object property is changed
+channelBlock = [modelName '/Fading Network Channel'];
+set_param(channelBlock, 'LinkStatus', 'inactive');
+set_param([channelBlock '/MATLAB System'], 'UseNativeFading', 'on');
+slbuild(modelName);
+exeFile = fullfile(pwd, modelName);
+if ispc
+    exeFile = exeFile + ".exe";
+end
+
+if isempty(paramSets)
+    return;
+end
+
+% One parameter structure per set, built from the model's default values
+rtP = rsimgetrtp(modelName, 'AddTunableParamInfo', 'on');
+names = fieldnames(paramSets);
+rtP = rsimsetrtpparam(rtP, numel(paramSets));
+for k = 1:numel(paramSets)
+    for n = 1:numel(names)
+        rtP = rsimsetrtpparam(rtP, k, names{n}, paramSets(k).(names{n}));
+    end
+end
+save(paramFile, '-struct', 'rtP');
+end
@@ -0,0 +1,332 @@
+/*
+ * networkFading.c
+ *
+ * Compiled multipath Rayleigh fading engine for the NetworkChannel System
+ * object. See networkFading.h.
+ *
+ * Each path p of a link has a fixed fractional-delay filter t_p (Lanczos
+ * windowed sinc, NF_PATH_TAPS taps around the delay). Its complex gain
+ * g_p(n) is a sum of NF_NUM_SINUSOIDS complex exponentials with random
+ * arrival angles and phases, which has a Jakes Doppler spectrum. The output
+ * is
+ *
+ *   y(n) = sum_p g_p(n) * sum_k t_p(k) x(n - first_p - k)
+ *
+ * The taps carry the path amplitude and the 1/sqrt(NF_NUM_SINUSOIDS)
+ * normalization, so E|g_p|^2 times the tap energy equals the average path
+ * gain. comm.RayleighChannel uses a different Doppler generator, so the
+ * realizations are statistically equivalent but not sample-identical.
+ */
+
+/* Include files */
+#include "networkFading.h"
+#include <emmintrin.h>
+#include <math.h>
+#include <string.h>
+
+/* Type Definitions */
+typedef struct {
+  boolean_T inUse;
+  int32_T numPaths;
+  int32_T historyLength;
+  int32_T pathFirstTap[NF_MAX_PATHS];
+  int32_T pathNumTaps[NF_MAX_PATHS];
+  real_T taps[NF_MAX_PATHS][NF_PATH_TAPS];
+  real_T omega[NF_MAX_PATHS][NF_NUM_SINUSOIDS];
+  real_T rotRe[NF_MAX_PATHS][NF_NUM_SINUSOIDS];
+  real_T rotIm[NF_MAX_PATHS][NF_NUM_SINUSOIDS];
+  real_T phase[NF_MAX_PATHS][NF_NUM_SINUSOIDS];
+  real_T time;
+  creal_T buffer[NF_MAX_DELAY + NF_BLOCK];
+} networkFadingLink;
+
+/* Variable Definitions */
+static networkFadingLink networkFadingLinks[NF_MAX_LINKS];
+
+/* Function Declarations */
+static real_T networkFading_uniform(uint64_T *state);
+static real_T networkFading_lanczos(real_T x);
+static void networkFading_pathGains(const networkFadingLink *link, int32_T p,
+  creal_T g[], int32_T m);
+static void networkFading_block(networkFadingLink *link, const creal_T x[],
+  creal_T y[], int32_T m);
+
+/* Function Definitions */
+static real_T networkFading_uniform(uint64_T *state)
+{
+  uint64_T z;
+
+  /* splitmix64, returning 53 bits in [0, 1) */
+  *state += 0x9E3779B97F4A7C15UL;
+  z = *state;
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9UL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBUL;
+  z ^= z >> 31;
+  return (real_T)(z >> 11) * 1.1102230246251565E-16;
+}
+
+static real_T networkFading_lanczos(real_T x)
+{
+  real_T px;
+  if (fabs(x) < 1.0E-12) {
+    return 1.0;
+  }
+
+  if (fabs(x) >= (real_T)NF_HALF_TAPS) {
+    return 0.0;
+  }
+
+  px = 3.1415926535897931 * x;
+  return (real_T)NF_HALF_TAPS * sin(px) * sin(px / (real_T)NF_HALF_TAPS) / (px *
+    px);
+}
+
+static void networkFading_pathGains(const networkFadingLink *link, int32_T p,
+  creal_T g[], int32_T m)
+{
+  __m128d cIm[NF_NUM_SINUSOIDS / 2];
+  __m128d cRe[NF_NUM_SINUSOIDS / 2];
+  __m128d rIm;
+  __m128d rRe;
+  __m128d re;
+  __m128d sumIm;
+  __m128d sumRe;
+  real_T arg[2];
+  real_T b_im[2];
+  real_T b_re[2];
+  int32_T i;
+  int32_T s;
+
+  /* Each sinusoid starts from its exact phase at the block time and is */
+  /* then advanced by a unit rotator, so rounding cannot build up across */
+  /* blocks. Sinusoids are handled two per SSE2 register. */
+  for (s = 0; s < NF_NUM_SINUSOIDS / 2; s++) {
+    for (i = 0; i < 2; i++) {
+      arg[i] = fmod(link->omega[p][2 * s + i] * link->time, 6.2831853071795862)
+        + link->phase[p][2 * s + i];
+      b_re[i] = cos(arg[i]);
+      b_im[i] = sin(arg[i]);
+    }
+
+    cRe[s] = _mm_loadu_pd(&b_re[0]);
+    cIm[s] = _mm_loadu_pd(&b_im[0]);
+  }
+
+  for (i = 0; i < m; i++) {
+    sumRe = _mm_setzero_pd();
+    sumIm = _mm_setzero_pd();
+    for (s = 0; s < NF_NUM_SINUSOIDS / 2; s++) {
+      sumRe = _mm_add_pd(sumRe, cRe[s]);
+      sumIm = _mm_add_pd(sumIm, cIm[s]);
+      rRe = _mm_loadu_pd(&link->rotRe[p][2 * s]);
+      rIm = _mm_loadu_pd(&link->rotIm[p][2 * s]);
+      re = _mm_sub_pd(_mm_mul_pd(cRe[s], rRe), _mm_mul_pd(cIm[s], rIm));
+      cIm[s] = _mm_add_pd(_mm_mul_pd(cRe[s], rIm), _mm_mul_pd(cIm[s], rRe));
+      cRe[s] = re;
+    }
+
+    _mm_storeu_pd(&b_re[0], sumRe);
+    _mm_storeu_pd(&b_im[0], sumIm);
+    g[i].re = b_re[0] + b_re[1];
+    g[i].im = b_im[0] + b_im[1];
+  }
+}
+
+static void networkFading_block(networkFadingLink *link, const creal_T x[],
+  creal_T y[], int32_T m)
+{
+  __m128d acc0;
+  __m128d acc1;
+  __m128d gz;
+  __m128d tap;
+  __m128d z;
+  creal_T g[NF_BLOCK];
+  creal_T zp[NF_BLOCK];
+  const creal_T *xp;
+  int32_T H;
+  int32_T i;
+  int32_T k;
+  int32_T p;
+
+  /* buffer holds the last H input samples followed by this block, so that */
+  /* x(n - d) for every tap delay d <= H is buffer[H + i - d]. */
+  H = link->historyLength;
+  memcpy(&link->buffer[H], x, (size_t)m * sizeof(creal_T));
+  for (p = 0; p < link->numPaths; p++) {
+    networkFading_pathGains(link, p, g, m);
+
+    /* Path filter. Fractional delays always use NF_PATH_TAPS taps (unused */
+    /* taps are zero), so the tap loop has a fixed trip count and stays in */
+    /* registers; integer delays are a single scaled copy. */
+    xp = &link->buffer[H - link->pathFirstTap[p]];
+    if (link->pathNumTaps[p] == 1) {
+      tap = _mm_set1_pd(link->taps[p][0]);
+      for (i = 0; i < m; i++) {
+        _mm_storeu_pd(&zp[i].re, _mm_mul_pd(tap, _mm_loadu_pd(&xp[i].re)));
+      }
+    } else {
+      for (i = 0; i < m; i++) {
+        acc0 = _mm_mul_pd(_mm_set1_pd(link->taps[p][0]), _mm_loadu_pd(&xp[i].re));
+        acc1 = _mm_mul_pd(_mm_set1_pd(link->taps[p][1]), _mm_loadu_pd(&xp[i - 1].
+          re));
+        for (k = 2; k < NF_PATH_TAPS; k += 2) {
+          acc0 = _mm_add_pd(acc0, _mm_mul_pd(_mm_set1_pd(link->taps[p][k]),
+            _mm_loadu_pd(&xp[i - k].re)));
+          acc1 = _mm_add_pd(acc1, _mm_mul_pd(_mm_set1_pd(link->taps[p][k + 1]),
+            _mm_loadu_pd(&xp[(i - k) - 1].re)));
+        }
+
+        _mm_storeu_pd(&zp[i].re, _mm_add_pd(acc0, acc1));
+      }
+    }
+
+    /* Complex path gain, accumulated into the output. */
+    for (i = 0; i < m; i++) {
+      z = _mm_loadu_pd(&zp[i].re);
+      gz = _mm_add_pd(_mm_mul_pd(_mm_set1_pd(g[i].re), z), _mm_xor_pd
+                      (_mm_mul_pd(_mm_set1_pd(g[i].im), _mm_shuffle_pd(z, z, 1)),
+                       _mm_set_pd(0.0, -0.0)));
+      _mm_storeu_pd(&y[i].re, _mm_add_pd(_mm_loadu_pd(&y[i].re), gz));
+    }
+  }
+
+  memmove(&link->buffer[0], &link->buffer[m], (size_t)H * sizeof(creal_T));
+  link->time += (real_T)m;
+}
+
+int32_T networkFadingCreate(const real_T pathDelays[], const real_T
+  averagePathGains[], int32_T numPaths, real_T maximumDopplerShift, real_T
+  sampleRate, uint32_T seed)
+{
+  networkFadingLink *link;
+  uint64_T rng;
+  real_T alpha;
+  real_T amplitude;
+  real_T d;
+  real_T theta;
+  int32_T first;
+  int32_T id;
+  int32_T k;
+  int32_T last;
+  int32_T p;
+  int32_T s;
+
+  /* Returns a handle, or -1 when the configuration is not supported or */
+  /* every link slot is in use. */
+  if ((numPaths < 1) || (numPaths > NF_MAX_PATHS) || (!(sampleRate > 0.0)) ||
+      (!(maximumDopplerShift >= 0.0))) {
+    return -1;
+  }
+
+  id = 0;
+  while ((id < NF_MAX_LINKS) && networkFadingLinks[id].inUse) {
+    id++;
+  }
+
+  if (id == NF_MAX_LINKS) {
+    return -1;
+  }
+
+  link = &networkFadingLinks[id];
+  memset(link, 0, sizeof(networkFadingLink));
+  link->numPaths = numPaths;
+  for (p = 0; p < numPaths; p++) {
+    d = pathDelays[p] * sampleRate;
+    if (!(d >= 0.0) || (d > (real_T)(NF_MAX_DELAY - NF_HALF_TAPS))) {
+      return -1;
+    }
+
+    amplitude = pow(10.0, averagePathGains[p] / 20.0) / sqrt((real_T)
+      NF_NUM_SINUSOIDS);
+
+    /* Integer delays need a single tap. Fractional delays keep the */
+    /* NF_PATH_TAPS nearest causal taps of the windowed sinc; near zero */
+    /* delay the window is shifted right and its outer taps are zero. */
+    if (fabs(d - floor(d + 0.5)) < 1.0E-9) {
+      first = (int32_T)floor(d + 0.5);
+      last = first;
+    } else {
+      first = (int32_T)floor(d) - NF_HALF_TAPS + 1;
+      if (first < 0) {
+        first = 0;
+      }
+
+      last = (first + NF_PATH_TAPS) - 1;
+    }
+
+    /* Tap k of path p weights x(n - first - k). */
+    link->pathFirstTap[p] = first;
+    link->pathNumTaps[p] = (last - first) + 1;
+    for (k = 0; k <= last - first; k++) {
+      link->taps[p][k] = amplitude * networkFading_lanczos((real_T)(first + k)
+        - d);
+    }
+
+    if (last > link->historyLength) {
+      link->historyLength = last;
+    }
+  }
+
+  rng = (uint64_T)seed;
+  for (p = 0; p < numPaths; p++) {
+    theta = 6.2831853071795862 * networkFading_uniform(&rng);
+    for (s = 0; s < NF_NUM_SINUSOIDS; s++) {
+      alpha = (6.2831853071795862 * (real_T)s + theta) / (real_T)
+        NF_NUM_SINUSOIDS;
+      link->omega[p][s] = 6.2831853071795862 * maximumDopplerShift / sampleRate
+        * cos(alpha);
+      link->rotRe[p][s] = cos(link->omega[p][s]);
+      link->rotIm[p][s] = sin(link->omega[p][s]);
+      link->phase[p][s] = 6.2831853071795862 * networkFading_uniform(&rng);
+    }
+  }
+
+  link->inUse = true;
+  return id;
+}
+
+void networkFadingStep(int32_T id, const creal_T x[], creal_T y[], int32_T n,
+  boolean_T accumulate)
+{
+  networkFadingLink *link;
+  int32_T i;
+  int32_T m;
+
+  /* Filters n samples of x through the link. The result is added to y when */
+  /* accumulate is true, so that several links can sum into one receiver */
+  /* column without a temporary; otherwise it overwrites y. */
+  if ((id < 0) || (id >= NF_MAX_LINKS) || (!networkFadingLinks[id].inUse)) {
+    return;
+  }
+
+  link = &networkFadingLinks[id];
+  if (!accumulate) {
+    memset(y, 0, (size_t)n * sizeof(creal_T));
+  }
+
+  for (i = 0; i < n; i += NF_BLOCK) {
+    m = n - i;
+    if (m > NF_BLOCK) {
+      m = NF_BLOCK;
+    }
+
+    networkFading_block(link, &x[i], &y[i], m);
+  }
+}
+
+void networkFadingReset(int32_T id)
+{
+  /* Restarts the same realization: time zero and an empty delay line. */
+  if ((id >= 0) && (id < NF_MAX_LINKS) && networkFadingLinks[id].inUse) {
+    networkFadingLinks[id].time = 0.0;
+    memset(networkFadingLinks[id].buffer, 0, sizeof(networkFadingLinks[id].
+            buffer));
+  }
+}
+
+void networkFadingRelease(int32_T id)
+{
+  if ((id >= 0) && (id < NF_MAX_LINKS)) {
+    networkFadingLinks[id].inUse = false;
+  }
+}
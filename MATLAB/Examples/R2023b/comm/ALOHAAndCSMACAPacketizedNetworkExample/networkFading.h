@@ -0,0 +1,48 @@
+/*
+ * networkFading.h
+ *
+ * Compiled multipath Rayleigh fading engine for the NetworkChannel System
+ * object. A link is created once from its path delays, average path gains,
+ * maximum Doppler shift and sample rate. Creation precomputes the
+ * fractional-delay filter taps of every path. Each step generates the
+ * Doppler-faded path gains for a block of samples and applies the per-path
+ * filters.
+ *
+ * Links are addressed by the integer handle returned from
+ * networkFadingCreate so that they can be held in a System object property
+ * and called through coder.ceval.
+ */
+
+#ifndef NETWORKFADING_H
+#define NETWORKFADING_H
+
+/* Include files */
+#include "rtwtypes.h"
+
+/* Named Constants */
+#define NF_MAX_LINKS                   (64)
+#define NF_MAX_PATHS                   (8)
+
+/* Filter taps kept on each side of a fractional path delay */
+#define NF_HALF_TAPS                   (4)
+#define NF_PATH_TAPS                   (2 * NF_HALF_TAPS)
+
+/* Longest supported path delay, in samples */
+#define NF_MAX_DELAY                   (256)
+
+/* Sinusoids summed per path by the Doppler generator */
+#define NF_NUM_SINUSOIDS               (16)
+
+/* Samples processed per block */
+#define NF_BLOCK                       (256)
+
+/* Function Declarations */
+extern int32_T networkFadingCreate(const real_T pathDelays[], const real_T
+  averagePathGains[], int32_T numPaths, real_T maximumDopplerShift, real_T
+  sampleRate, uint32_T seed);
+extern void networkFadingStep(int32_T id, const creal_T x[], creal_T y[],
+  int32_T n, boolean_T accumulate);
+extern void networkFadingReset(int32_T id);
+extern void networkFadingRelease(int32_T id);
+
+#endif                                 /* NETWORKFADING_H */
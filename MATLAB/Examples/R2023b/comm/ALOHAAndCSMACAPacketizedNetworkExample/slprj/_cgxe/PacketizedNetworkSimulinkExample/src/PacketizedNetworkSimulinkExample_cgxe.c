@@ -16,3 +16,36 @@ unsigned int cgxe_PacketizedNetworkSimulinkExample_method_dispatcher(SimStruct*
 
   return 0;
 }
+
+unsigned int cgxe_PacketizedNetworkSimulinkExample_batch_outputs(SimStruct* S[],
+  int_T n)
+{
+  int_T i;
+  int_T j;
+  unsigned int count = 0;
+
+  /* Runs mdlOutputs for n blocks, handing each contiguous run of blocks */
+  /* from the same module to that module's batch entry point. Blocks that */
+  /* match no module are skipped. Returns the number of blocks stepped. */
+  i = 0;
+  while (i < n) {
+    j = i;
+    while ((j < n) &&
+           ssGetChecksum0(S[j]) == 3555681173 &&
+           ssGetChecksum1(S[j]) == 210201439 &&
+           ssGetChecksum2(S[j]) == 3739409047 &&
+           ssGetChecksum3(S[j]) == 1544329537) {
+      j++;
+    }
+
+    if (j > i) {
+      outputs_batch_6ZqTk0OKN5QuhEtSrZC29B(&S[i], j - i);
+      count += (unsigned int)(j - i);
+      i = j;
+    } else {
+      i++;
+    }
+  }
+
+  return count;
+}
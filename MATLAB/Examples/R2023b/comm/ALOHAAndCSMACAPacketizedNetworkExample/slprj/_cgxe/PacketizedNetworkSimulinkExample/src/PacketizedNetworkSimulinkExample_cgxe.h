@@ -22,5 +22,7 @@
 
 extern unsigned int cgxe_PacketizedNetworkSimulinkExample_method_dispatcher
   (SimStruct* S, int_T method, void* data);
+extern unsigned int cgxe_PacketizedNetworkSimulinkExample_batch_outputs
+  (SimStruct* S[], int_T n);
 
 #endif
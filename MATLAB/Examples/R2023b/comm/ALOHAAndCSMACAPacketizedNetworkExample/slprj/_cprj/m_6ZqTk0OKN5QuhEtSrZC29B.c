@@ -3,12 +3,58 @@
 #include "modelInterface.h"
 #include "m_6ZqTk0OKN5QuhEtSrZC29B.h"
 #include <emmintrin.h>
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
 #include "mwmathutil.h"
+#include "networkFading.h"
+#include <string.h>
 
 /* Type Definitions */
 
 /* Named Constants */
 
+/* Release profile: build with -DAWGN_RELEASE_PROFILE to serve steady-state */
+/* steps without emlrtStack site tracking. Any step that may need to */
+/* validate or report goes through the regular, cold step function. */
+#ifdef AWGN_RELEASE_PROFILE
+#if defined(__GNUC__)
+#define AWGN_COLD                      __attribute__((cold, noinline))
+#elif defined(_MSC_VER)
+#define AWGN_COLD                      __declspec(noinline)
+#else
+#define AWGN_COLD
+#endif
+#else
+#define AWGN_COLD
+#endif
+
+/* Instrumentation build: build with -DAWGN_TSC_PROFILE to count the time */
+/* stamp counter cycles spent by each instance in setup, tunable property */
+/* handling, normal deviate generation and the noise-add loop, and in the */
+/* whole output step. The counters are written at terminate, one line per */
+/* instance, to the file named by the AWGN_TSC_PROFILE_FILE environment */
+/* variable or to stderr. Without the flag the probes compile to nothing. */
+#ifdef AWGN_TSC_PROFILE
+#include <stdio.h>
+#include <stdlib.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define AWGN_TSC_READ()                ((uint64_T)__rdtsc())
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define AWGN_TSC_READ()                ((uint64_T)__rdtsc())
+#else
+#define AWGN_TSC_READ()                awgnTscReadClock()
+#endif
+#define AWGN_TSC_BEGIN(t0)             uint64_T t0 = AWGN_TSC_READ()
+#define AWGN_TSC_END(tsc, phase, t0)   do { if ((tsc) != NULL) { (tsc)->cycles[(phase)] += AWGN_TSC_READ() - (t0); (tsc)->calls[(phase)]++; } } while (0)
+#else
+#define AWGN_TSC_BEGIN(t0)
+#define AWGN_TSC_END(tsc, phase, t0)
+#endif
+
 /* Variable Declarations */
 
 /* Variable Definitions */
@@ -27,11 +73,6 @@ static emlrtRSInfo c_emlrtRSI = { 1,   /* lineNo */
   "/usr/local/MATLAB/R2023b/toolbox/comm/comm/compiled/+comm/+internal/Helper.p"/* pathName */
 };
 
-static emlrtRSInfo d_emlrtRSI = { 1,   /* lineNo */
-  "System",                            /* fcnName */
-  "/usr/local/MATLAB/R2023b/toolbox/shared/system/coder/+matlab/+system/+coder/System.p"/* pathName */
-};
-
 static emlrtRSInfo e_emlrtRSI = { 1,   /* lineNo */
   "SystemProp",                        /* fcnName */
   "/usr/local/MATLAB/R2023b/toolbox/shared/system/coder/+matlab/+system/+coder/SystemProp.p"/* pathName */
@@ -102,26 +143,6 @@ static emlrtRSInfo r_emlrtRSI = { 132, /* lineNo */
   "/usr/local/MATLAB/R2023b/toolbox/eml/lib/matlab/randfun/rng.m"/* pathName */
 };
 
-static emlrtRSInfo s_emlrtRSI = { 282, /* lineNo */
-  "rng",                               /* fcnName */
-  "/usr/local/MATLAB/R2023b/toolbox/eml/lib/matlab/randfun/rng.m"/* pathName */
-};
-
-static emlrtRSInfo t_emlrtRSI = { 284, /* lineNo */
-  "rng",                               /* fcnName */
-  "/usr/local/MATLAB/R2023b/toolbox/eml/lib/matlab/randfun/rng.m"/* pathName */
-};
-
-static emlrtRSInfo u_emlrtRSI = { 286, /* lineNo */
-  "rng",                               /* fcnName */
-  "/usr/local/MATLAB/R2023b/toolbox/eml/lib/matlab/randfun/rng.m"/* pathName */
-};
-
-static emlrtRSInfo v_emlrtRSI = { 287, /* lineNo */
-  "rng",                               /* fcnName */
-  "/usr/local/MATLAB/R2023b/toolbox/eml/lib/matlab/randfun/rng.m"/* pathName */
-};
-
 static emlrtRSInfo w_emlrtRSI = { 69,  /* lineNo */
   "RandStream",                        /* fcnName */
   "/usr/local/MATLAB/R2023b/toolbox/eml/eml/+coder/+internal/RandStream.m"/* pathName */
@@ -132,21 +153,6 @@ static emlrtRSInfo x_emlrtRSI = { 141, /* lineNo */
   "/usr/local/MATLAB/R2023b/toolbox/eml/eml/+coder/+internal/RandStream.m"/* pathName */
 };
 
-static emlrtRSInfo y_emlrtRSI = { 27,  /* lineNo */
-  "mt19937ar",                         /* fcnName */
-  "/usr/local/MATLAB/R2023b/toolbox/eml/eml/+coder/+internal/mt19937ar.m"/* pathName */
-};
-
-static emlrtRSInfo ab_emlrtRSI = { 31, /* lineNo */
-  "mt19937ar",                         /* fcnName */
-  "/usr/local/MATLAB/R2023b/toolbox/eml/eml/+coder/+internal/mt19937ar.m"/* pathName */
-};
-
-static emlrtRSInfo bb_emlrtRSI = { 67, /* lineNo */
-  "CoreRng",                           /* fcnName */
-  "/usr/local/MATLAB/R2023b/toolbox/eml/eml/+coder/+internal/CoreRng.m"/* pathName */
-};
-
 static emlrtRSInfo cb_emlrtRSI = { 239,/* lineNo */
   "AWGNChannelBase",                   /* fcnName */
   "/usr/local/MATLAB/R2023b/toolbox/comm/comm/+comm/+internal/AWGNChannelBase.m"/* pathName */
@@ -177,21 +183,6 @@ static emlrtRSInfo hb_emlrtRSI = { 60, /* lineNo */
   ""                                   /* pathName */
 };
 
-static emlrtRSInfo ib_emlrtRSI = { 348,/* lineNo */
-  "AWGNChannel",                       /* fcnName */
-  "/usr/local/MATLAB/R2023b/toolbox/comm/comm/+comm/+internal/AWGNChannel.m"/* pathName */
-};
-
-static emlrtRSInfo jb_emlrtRSI = { 177,/* lineNo */
-  "RandStream",                        /* fcnName */
-  "/usr/local/MATLAB/R2023b/toolbox/eml/eml/+coder/+internal/RandStream.m"/* pathName */
-};
-
-static emlrtRSInfo kb_emlrtRSI = { 180,/* lineNo */
-  "RandStream",                        /* fcnName */
-  "/usr/local/MATLAB/R2023b/toolbox/eml/eml/+coder/+internal/RandStream.m"/* pathName */
-};
-
 static emlrtRSInfo lb_emlrtRSI = { 350,/* lineNo */
   "AWGNChannelBase",                   /* fcnName */
   "/usr/local/MATLAB/R2023b/toolbox/comm/comm/+comm/+internal/AWGNChannelBase.m"/* pathName */
@@ -207,21 +198,11 @@ static emlrtRSInfo nb_emlrtRSI = { 225,/* lineNo */
   "/usr/local/MATLAB/R2023b/toolbox/eml/eml/+coder/+internal/RandStream.m"/* pathName */
 };
 
-static emlrtRSInfo ob_emlrtRSI = { 227,/* lineNo */
-  "RandStream",                        /* fcnName */
-  "/usr/local/MATLAB/R2023b/toolbox/eml/eml/+coder/+internal/RandStream.m"/* pathName */
-};
-
 static emlrtRSInfo pb_emlrtRSI = { 36, /* lineNo */
   "mt19937ar",                         /* fcnName */
   "/usr/local/MATLAB/R2023b/toolbox/eml/eml/+coder/+internal/mt19937ar.m"/* pathName */
 };
 
-static emlrtRSInfo qb_emlrtRSI = { 40, /* lineNo */
-  "mt19937ar",                         /* fcnName */
-  "/usr/local/MATLAB/R2023b/toolbox/eml/eml/+coder/+internal/mt19937ar.m"/* pathName */
-};
-
 static emlrtRSInfo rb_emlrtRSI = { 336,/* lineNo */
   "mt19937ar",                         /* fcnName */
   "/usr/local/MATLAB/R2023b/toolbox/eml/eml/+coder/+internal/mt19937ar.m"/* pathName */
@@ -247,46 +228,6 @@ static emlrtRSInfo vb_emlrtRSI = { 150,/* lineNo */
   "/usr/local/MATLAB/R2023b/toolbox/eml/eml/+coder/+internal/mt19937ar.m"/* pathName */
 };
 
-static emlrtRSInfo wb_emlrtRSI = { 250,/* lineNo */
-  "RandStream",                        /* fcnName */
-  "/usr/local/MATLAB/R2023b/toolbox/eml/eml/+coder/+internal/RandStream.m"/* pathName */
-};
-
-static emlrtRSInfo xb_emlrtRSI = { 252,/* lineNo */
-  "RandStream",                        /* fcnName */
-  "/usr/local/MATLAB/R2023b/toolbox/eml/eml/+coder/+internal/RandStream.m"/* pathName */
-};
-
-static emlrtRSInfo yb_emlrtRSI = { 254,/* lineNo */
-  "RandStream",                        /* fcnName */
-  "/usr/local/MATLAB/R2023b/toolbox/eml/eml/+coder/+internal/RandStream.m"/* pathName */
-};
-
-static emlrtRSInfo ac_emlrtRSI = { 329,/* lineNo */
-  "RandStream",                        /* fcnName */
-  "/usr/local/MATLAB/R2023b/toolbox/eml/eml/+coder/+internal/RandStream.m"/* pathName */
-};
-
-static emlrtRSInfo bc_emlrtRSI = { 333,/* lineNo */
-  "RandStream",                        /* fcnName */
-  "/usr/local/MATLAB/R2023b/toolbox/eml/eml/+coder/+internal/RandStream.m"/* pathName */
-};
-
-static emlrtRSInfo cc_emlrtRSI = { 345,/* lineNo */
-  "RandStream",                        /* fcnName */
-  "/usr/local/MATLAB/R2023b/toolbox/eml/eml/+coder/+internal/RandStream.m"/* pathName */
-};
-
-static emlrtRSInfo dc_emlrtRSI = { 352,/* lineNo */
-  "RandStream",                        /* fcnName */
-  "/usr/local/MATLAB/R2023b/toolbox/eml/eml/+coder/+internal/RandStream.m"/* pathName */
-};
-
-static emlrtRSInfo ec_emlrtRSI = { 358,/* lineNo */
-  "RandStream",                        /* fcnName */
-  "/usr/local/MATLAB/R2023b/toolbox/eml/eml/+coder/+internal/RandStream.m"/* pathName */
-};
-
 static emlrtRSInfo fc_emlrtRSI = { 201,/* lineNo */
   "RandStream",                        /* fcnName */
   "/usr/local/MATLAB/R2023b/toolbox/eml/eml/+coder/+internal/RandStream.m"/* pathName */
@@ -302,11 +243,6 @@ static emlrtRSInfo hc_emlrtRSI = { 377,/* lineNo */
   "/usr/local/MATLAB/R2023b/toolbox/eml/eml/+coder/+internal/RandStream.m"/* pathName */
 };
 
-static emlrtRSInfo ic_emlrtRSI = { 381,/* lineNo */
-  "RandStream",                        /* fcnName */
-  "/usr/local/MATLAB/R2023b/toolbox/eml/eml/+coder/+internal/RandStream.m"/* pathName */
-};
-
 static emlrtRSInfo jc_emlrtRSI = { 401,/* lineNo */
   "RandStream",                        /* fcnName */
   "/usr/local/MATLAB/R2023b/toolbox/eml/eml/+coder/+internal/RandStream.m"/* pathName */
@@ -317,11 +253,6 @@ static emlrtRSInfo kc_emlrtRSI = { 419,/* lineNo */
   "/usr/local/MATLAB/R2023b/toolbox/eml/eml/+coder/+internal/RandStream.m"/* pathName */
 };
 
-static emlrtRSInfo lc_emlrtRSI = { 423,/* lineNo */
-  "RandStream",                        /* fcnName */
-  "/usr/local/MATLAB/R2023b/toolbox/eml/eml/+coder/+internal/RandStream.m"/* pathName */
-};
-
 static emlrtRSInfo mc_emlrtRSI = { 439,/* lineNo */
   "RandStream",                        /* fcnName */
   "/usr/local/MATLAB/R2023b/toolbox/eml/eml/+coder/+internal/RandStream.m"/* pathName */
@@ -381,6 +312,12 @@ static emlrtMCInfo i_emlrtMCI = { 157, /* lineNo */
   "/usr/local/MATLAB/R2023b/toolbox/eml/eml/+coder/+internal/mt19937ar.m"/* pName */
 };
 
+static emlrtRTEInfo emlrtRTEI = { 1,   /* lineNo */
+  1,                                   /* colNo */
+  "AWGNChannel",                       /* fName */
+  "/usr/local/MATLAB/R2023b/toolbox/comm/comm/+comm/+internal/AWGNChannel.m"/* pName */
+};
+
 static emlrtRSInfo nc_emlrtRSI = { 13, /* lineNo */
   "sqrt",                              /* fcnName */
   "/usr/local/MATLAB/R2023b/toolbox/eml/lib/matlab/elfun/sqrt.m"/* pathName */
@@ -421,8 +358,193 @@ static emlrtRSInfo uc_emlrtRSI = { 244,/* lineNo */
   "/usr/local/MATLAB/R2023b/toolbox/comm/comm/+comm/+internal/AWGNChannelBase.m"/* pathName */
 };
 
+static const real_T mtziggurat_x[257] = { 0.0, 0.215241895984875,
+  0.286174591792068, 0.335737519214422, 0.375121332878378, 0.408389134611989,
+  0.43751840220787, 0.46363433679088, 0.487443966139235, 0.50942332960209,
+  0.529909720661557, 0.549151702327164, 0.567338257053817, 0.584616766106378,
+  0.601104617755991, 0.61689699000775, 0.63207223638606, 0.646695714894993,
+  0.660822574244419, 0.674499822837293, 0.687767892795788, 0.700661841106814,
+  0.713212285190975, 0.725446140909999, 0.737387211434295, 0.749056662017815,
+  0.760473406430107, 0.771654424224568, 0.782615023307232, 0.793369058840623,
+  0.80392911698997, 0.814306670135215, 0.824512208752291, 0.834555354086381,
+  0.844444954909153, 0.854189171008163, 0.863795545553308, 0.87327106808886,
+  0.882622229585165, 0.891855070732941, 0.900975224461221, 0.909987953496718,
+  0.91889818364959, 0.927710533401999, 0.936429340286575, 0.945058684468165,
+  0.953602409881086, 0.96206414322304, 0.970447311064224, 0.978755155294224,
+  0.986990747099062, 0.99515699963509, 1.00325667954467, 1.01129241744,
+  1.01926671746548, 1.02718196603564, 1.03504043983344, 1.04284431314415,
+  1.05059566459093, 1.05829648333067, 1.06594867476212, 1.07355406579244,
+  1.0811144097034, 1.08863139065398, 1.09610662785202, 1.10354167942464,
+  1.11093804601357, 1.11829717411934, 1.12562045921553, 1.13290924865253,
+  1.14016484436815, 1.14738850542085, 1.15458145035993, 1.16174485944561,
+  1.16887987673083, 1.17598761201545, 1.18306914268269, 1.19012551542669,
+  1.19715774787944, 1.20416683014438, 1.2111537262437, 1.21811937548548,
+  1.22506469375653, 1.23199057474614, 1.23889789110569, 1.24578749554863,
+  1.2526602218949, 1.25951688606371, 1.26635828701823, 1.27318520766536,
+  1.27999841571382, 1.28679866449324, 1.29358669373695, 1.30036323033084,
+  1.30712898903073, 1.31388467315022, 1.32063097522106, 1.32736857762793,
+  1.33409815321936, 1.3408203658964, 1.34753587118059, 1.35424531676263,
+  1.36094934303328, 1.36764858359748, 1.37434366577317, 1.38103521107586,
+  1.38772383568998, 1.39441015092814, 1.40109476367925, 1.4077782768464,
+  1.41446128977547, 1.42114439867531, 1.42782819703026, 1.43451327600589,
+  1.44120022484872, 1.44788963128058, 1.45458208188841, 1.46127816251028,
+  1.46797845861808, 1.47468355569786, 1.48139403962819, 1.48811049705745,
+  1.49483351578049, 1.50156368511546, 1.50830159628131, 1.51504784277671,
+  1.521803020761, 1.52856772943771, 1.53534257144151, 1.542128153229,
+  1.54892508547417, 1.55573398346918, 1.56255546753104, 1.56939016341512,
+  1.57623870273591, 1.58310172339603, 1.58997987002419, 1.59687379442279,
+  1.60378415602609, 1.61071162236983, 1.61765686957301, 1.62462058283303,
+  1.63160345693487, 1.63860619677555, 1.64562951790478, 1.65267414708306,
+  1.65974082285818, 1.66683029616166, 1.67394333092612, 1.68108070472517,
+  1.68824320943719, 1.69543165193456, 1.70264685479992, 1.7098896570713,
+  1.71716091501782, 1.72446150294804, 1.73179231405296, 1.73915426128591,
+  1.74654827828172, 1.75397532031767, 1.76143636531891, 1.76893241491127,
+  1.77646449552452, 1.78403365954944, 1.79164098655216, 1.79928758454972,
+  1.80697459135082, 1.81470317596628, 1.82247454009388, 1.83028991968276,
+  1.83815058658281, 1.84605785028518, 1.8540130597602, 1.86201760539967,
+  1.87007292107127, 1.878180486293, 1.88634182853678, 1.8945585256707,
+  1.90283220855043, 1.91116456377125, 1.91955733659319, 1.92801233405266,
+  1.93653142827569, 1.94511656000868, 1.95376974238465, 1.96249306494436,
+  1.97128869793366, 1.98015889690048, 1.98910600761744, 1.99813247135842,
+  2.00724083056053, 2.0164337349062, 2.02571394786385, 2.03508435372962,
+  2.04454796521753, 2.05410793165065, 2.06376754781173, 2.07353026351874,
+  2.0833996939983, 2.09337963113879, 2.10347405571488, 2.11368715068665,
+  2.12402331568952, 2.13448718284602, 2.14508363404789, 2.15581781987674,
+  2.16669518035431, 2.17772146774029, 2.18890277162636, 2.20024554661128,
+  2.21175664288416, 2.22344334009251, 2.23531338492992, 2.24737503294739,
+  2.25963709517379, 2.27210899022838, 2.28480080272449, 2.29772334890286,
+  2.31088825060137, 2.32430801887113, 2.33799614879653, 2.35196722737914,
+  2.36623705671729, 2.38082279517208, 2.39574311978193, 2.41101841390112,
+  2.42667098493715, 2.44272531820036, 2.4592083743347, 2.47614993967052,
+  2.49358304127105, 2.51154444162669, 2.53007523215985, 2.54922155032478,
+  2.56903545268184, 2.58957598670829, 2.61091051848882, 2.63311639363158,
+  2.65628303757674, 2.68051464328574, 2.70593365612306, 2.73268535904401,
+  2.76094400527999, 2.79092117400193, 2.82287739682644, 2.85713873087322,
+  2.89412105361341, 2.93436686720889, 2.97860327988184, 3.02783779176959,
+  3.08352613200214, 3.147889289518, 3.2245750520478, 3.32024473383983,
+  3.44927829856143, 3.65415288536101, 3.91075795952492 };
+
+static const uint32_T mt19937ar_state5489[625] = { 5489U, 1301868182U,
+  2938499221U, 2950281878U, 1875628136U, 751856242U, 944701696U, 2243192071U,
+  694061057U, 219885934U, 2066767472U, 3182869408U, 485472502U, 2336857883U,
+  1071588843U, 3418470598U, 951210697U, 3693558366U, 2923482051U, 1793174584U,
+  2982310801U, 1586906132U, 1951078751U, 1808158765U, 1733897588U, 431328322U,
+  4202539044U, 530658942U, 1714810322U, 3025256284U, 3342585396U, 1937033938U,
+  2640572511U, 1654299090U, 3692403553U, 4233871309U, 3497650794U, 862629010U,
+  2943236032U, 2426458545U, 1603307207U, 1133453895U, 3099196360U, 2208657629U,
+  2747653927U, 931059398U, 761573964U, 3157853227U, 785880413U, 730313442U,
+  124945756U, 2937117055U, 3295982469U, 1724353043U, 3021675344U, 3884886417U,
+  4010150098U, 4056961966U, 699635835U, 2681338818U, 1339167484U, 720757518U,
+  2800161476U, 2376097373U, 1532957371U, 3902664099U, 1238982754U, 3725394514U,
+  3449176889U, 3570962471U, 4287636090U, 4087307012U, 3603343627U, 202242161U,
+  2995682783U, 1620962684U, 3704723357U, 371613603U, 2814834333U, 2111005706U,
+  624778151U, 2094172212U, 4284947003U, 1211977835U, 991917094U, 1570449747U,
+  2962370480U, 1259410321U, 170182696U, 146300961U, 2836829791U, 619452428U,
+  2723670296U, 1881399711U, 1161269684U, 1675188680U, 4132175277U, 780088327U,
+  3409462821U, 1036518241U, 1834958505U, 3048448173U, 161811569U, 618488316U,
+  44795092U, 3918322701U, 1924681712U, 3239478144U, 383254043U, 4042306580U,
+  2146983041U, 3992780527U, 3518029708U, 3545545436U, 3901231469U, 1896136409U,
+  2028528556U, 2339662006U, 501326714U, 2060962201U, 2502746480U, 561575027U,
+  581893337U, 3393774360U, 1778912547U, 3626131687U, 2175155826U, 319853231U,
+  986875531U, 819755096U, 2915734330U, 2688355739U, 3482074849U, 2736559U,
+  2296975761U, 1029741190U, 2876812646U, 690154749U, 579200347U, 4027461746U,
+  1285330465U, 2701024045U, 4117700889U, 759495121U, 3332270341U, 2313004527U,
+  2277067795U, 4131855432U, 2722057515U, 1264804546U, 3848622725U, 2211267957U,
+  4100593547U, 959123777U, 2130745407U, 3194437393U, 486673947U, 1377371204U,
+  17472727U, 352317554U, 3955548058U, 159652094U, 1232063192U, 3835177280U,
+  49423123U, 3083993636U, 733092U, 2120519771U, 2573409834U, 1112952433U,
+  3239502554U, 761045320U, 1087580692U, 2540165110U, 641058802U, 1792435497U,
+  2261799288U, 1579184083U, 627146892U, 2165744623U, 2200142389U, 2167590760U,
+  2381418376U, 1793358889U, 3081659520U, 1663384067U, 2009658756U, 2689600308U,
+  739136266U, 2304581039U, 3529067263U, 591360555U, 525209271U, 3131882996U,
+  294230224U, 2076220115U, 3113580446U, 1245621585U, 1386885462U, 3203270426U,
+  123512128U, 12350217U, 354956375U, 4282398238U, 3356876605U, 3888857667U,
+  157639694U, 2616064085U, 1563068963U, 2762125883U, 4045394511U, 4180452559U,
+  3294769488U, 1684529556U, 1002945951U, 3181438866U, 22506664U, 691783457U,
+  2685221343U, 171579916U, 3878728600U, 2475806724U, 2030324028U, 3331164912U,
+  1708711359U, 1970023127U, 2859691344U, 2588476477U, 2748146879U, 136111222U,
+  2967685492U, 909517429U, 2835297809U, 3206906216U, 3186870716U, 341264097U,
+  2542035121U, 3353277068U, 548223577U, 3170936588U, 1678403446U, 297435620U,
+  2337555430U, 466603495U, 1132321815U, 1208589219U, 696392160U, 894244439U,
+  2562678859U, 470224582U, 3306867480U, 201364898U, 2075966438U, 1767227936U,
+  2929737987U, 3674877796U, 2654196643U, 3692734598U, 3528895099U, 2796780123U,
+  3048728353U, 842329300U, 191554730U, 2922459673U, 3489020079U, 3979110629U,
+  1022523848U, 2202932467U, 3583655201U, 3565113719U, 587085778U, 4176046313U,
+  3013713762U, 950944241U, 396426791U, 3784844662U, 3477431613U, 3594592395U,
+  2782043838U, 3392093507U, 3106564952U, 2829419931U, 1358665591U, 2206918825U,
+  3170783123U, 31522386U, 2988194168U, 1782249537U, 1105080928U, 843500134U,
+  1225290080U, 1521001832U, 3605886097U, 2802786495U, 2728923319U, 3996284304U,
+  903417639U, 1171249804U, 1020374987U, 2824535874U, 423621996U, 1988534473U,
+  2493544470U, 1008604435U, 1756003503U, 1488867287U, 1386808992U, 732088248U,
+  1780630732U, 2482101014U, 976561178U, 1543448953U, 2602866064U, 2021139923U,
+  1952599828U, 2360242564U, 2117959962U, 2753061860U, 2388623612U, 4138193781U,
+  2962920654U, 2284970429U, 766920861U, 3457264692U, 2879611383U, 815055854U,
+  2332929068U, 1254853997U, 3740375268U, 3799380844U, 4091048725U, 2006331129U,
+  1982546212U, 686850534U, 1907447564U, 2682801776U, 2780821066U, 998290361U,
+  1342433871U, 4195430425U, 607905174U, 3902331779U, 2454067926U, 1708133115U,
+  1170874362U, 2008609376U, 3260320415U, 2211196135U, 433538229U, 2728786374U,
+  2189520818U, 262554063U, 1182318347U, 3710237267U, 1221022450U, 715966018U,
+  2417068910U, 2591870721U, 2870691989U, 3418190842U, 4238214053U, 1540704231U,
+  1575580968U, 2095917976U, 4078310857U, 2313532447U, 2110690783U, 4056346629U,
+  4061784526U, 1123218514U, 551538993U, 597148360U, 4120175196U, 3581618160U,
+  3181170517U, 422862282U, 3227524138U, 1713114790U, 662317149U, 1230418732U,
+  928171837U, 1324564878U, 1928816105U, 1786535431U, 2878099422U, 3290185549U,
+  539474248U, 1657512683U, 552370646U, 1671741683U, 3655312128U, 1552739510U,
+  2605208763U, 1441755014U, 181878989U, 3124053868U, 1447103986U, 3183906156U,
+  1728556020U, 3502241336U, 3055466967U, 1013272474U, 818402132U, 1715099063U,
+  2900113506U, 397254517U, 4194863039U, 1009068739U, 232864647U, 2540223708U,
+  2608288560U, 2415367765U, 478404847U, 3455100648U, 3182600021U, 2115988978U,
+  434269567U, 4117179324U, 3461774077U, 887256537U, 3545801025U, 286388911U,
+  3451742129U, 1981164769U, 786667016U, 3310123729U, 3097811076U, 2224235657U,
+  2959658883U, 3370969234U, 2514770915U, 3345656436U, 2677010851U, 2206236470U,
+  271648054U, 2342188545U, 4292848611U, 3646533909U, 3754009956U, 3803931226U,
+  4160647125U, 1477814055U, 4043852216U, 1876372354U, 3133294443U, 3871104810U,
+  3177020907U, 2074304428U, 3479393793U, 759562891U, 164128153U, 1839069216U,
+  2114162633U, 3989947309U, 3611054956U, 1333547922U, 835429831U, 494987340U,
+  171987910U, 1252001001U, 370809172U, 3508925425U, 2535703112U, 1276855041U,
+  1922855120U, 835673414U, 3030664304U, 613287117U, 171219893U, 3423096126U,
+  3376881639U, 2287770315U, 1658692645U, 1262815245U, 3957234326U, 1168096164U,
+  2968737525U, 2655813712U, 2132313144U, 3976047964U, 326516571U, 353088456U,
+  3679188938U, 3205649712U, 2654036126U, 1249024881U, 880166166U, 691800469U,
+  2229503665U, 1673458056U, 4032208375U, 1851778863U, 2563757330U, 376742205U,
+  1794655231U, 340247333U, 1505873033U, 396524441U, 879666767U, 3335579166U,
+  3260764261U, 3335999539U, 506221798U, 4214658741U, 975887814U, 2080536343U,
+  3360539560U, 571586418U, 138896374U, 4234352651U, 2737620262U, 3928362291U,
+  1516365296U, 38056726U, 3599462320U, 3585007266U, 3850961033U, 471667319U,
+  1536883193U, 2310166751U, 1861637689U, 2530999841U, 4139843801U, 2710569485U,
+  827578615U, 2012334720U, 2907369459U, 3029312804U, 2820112398U, 1965028045U,
+  35518606U, 2478379033U, 643747771U, 1924139484U, 4123405127U, 3811735531U,
+  3429660832U, 3285177704U, 1948416081U, 1311525291U, 1183517742U, 1739192232U,
+  3979815115U, 2567840007U, 4116821529U, 213304419U, 4125718577U, 1473064925U,
+  2442436592U, 1893310111U, 4195361916U, 3747569474U, 828465101U, 2991227658U,
+  750582866U, 1205170309U, 1409813056U, 678418130U, 1171531016U, 3821236156U,
+  354504587U, 4202874632U, 3882511497U, 1893248677U, 1903078632U, 26340130U,
+  2069166240U, 3657122492U, 3725758099U, 831344905U, 811453383U, 3447711422U,
+  2434543565U, 4166886888U, 3358210805U, 4142984013U, 2988152326U, 3527824853U,
+  982082992U, 2809155763U, 190157081U, 3340214818U, 2365432395U, 2548636180U,
+  2894533366U, 3474657421U, 2372634704U, 2845748389U, 43024175U, 2774226648U,
+  1987702864U, 3186502468U, 453610222U, 4204736567U, 1392892630U, 2471323686U,
+  2470534280U, 3541393095U, 4269885866U, 3909911300U, 759132955U, 1482612480U,
+  667715263U, 1795580598U, 2337923983U, 3390586366U, 581426223U, 1515718634U,
+  476374295U, 705213300U, 363062054U, 2084697697U, 2407503428U, 2292957699U,
+  2426213835U, 2199989172U, 1987356470U, 4026755612U, 2147252133U, 270400031U,
+  1367820199U, 2369854699U, 2844269403U, 79981964U, 624U };
+
+
 /* Function Declarations */
 static void cgxe_mdl_start(InstanceStruct_6ZqTk0OKN5QuhEtSrZC29B *moduleInstance);
+
+#ifdef AWGN_TSC_PROFILE
+#if !defined(_MSC_VER) && !defined(__x86_64__) && !defined(__i386__)
+
+static uint64_T awgnTscReadClock(void);
+
+#endif
+
+static void awgnTscReport(InstanceStruct_6ZqTk0OKN5QuhEtSrZC29B *moduleInstance);
+
+#endif
+
 static void cgxe_mdl_initialize(InstanceStruct_6ZqTk0OKN5QuhEtSrZC29B
   *moduleInstance);
 static void cgxe_mdl_outputs(InstanceStruct_6ZqTk0OKN5QuhEtSrZC29B
@@ -452,23 +574,48 @@ static real_T now(void);
 static real_T b_mod(real_T x);
 static void AWGNChannelBase_getStandardDeviation(const emlrtStack *sp,
   comm_internal_AWGNChannel *obj);
+static int32_T AWGNChannelBase_stdCacheIndex(real_T b_EbNo);
 static void SystemCore_checkTunablePropChange(const emlrtStack *sp,
   comm_internal_AWGNChannel *obj);
 static void mw__internal__call__reset(InstanceStruct_6ZqTk0OKN5QuhEtSrZC29B
   *moduleInstance, const emlrtStack *sp, real_T b_EbNo[3], real_T b_SignalPower);
-static void mw__internal__call__step(InstanceStruct_6ZqTk0OKN5QuhEtSrZC29B
-  *moduleInstance, const emlrtStack *sp, real_T b_EbNo[3], real_T b_SignalPower,
-  creal_T b_u0[3], creal_T c_y0[3]);
+static AWGN_COLD void mw__internal__call__step
+  (InstanceStruct_6ZqTk0OKN5QuhEtSrZC29B *moduleInstance, const emlrtStack *sp,
+   real_T b_EbNo[3], real_T b_SignalPower, creal_T b_u0[], creal_T c_y0[], const
+   real_T stdIn[], int32_T frameLength);
+static boolean_T AWGNChannel_isSteadyState
+  (InstanceStruct_6ZqTk0OKN5QuhEtSrZC29B *moduleInstance, const real_T b_EbNo[3],
+   real_T b_SignalPower);
+
+#ifdef AWGN_RELEASE_PROFILE
+
+static void mw__internal__call__stepRelease
+  (InstanceStruct_6ZqTk0OKN5QuhEtSrZC29B *moduleInstance, const emlrtStack *sp,
+   real_T b_EbNo[3], real_T b_SignalPower, creal_T b_u0[], creal_T c_y0[], const
+   real_T stdIn[], int32_T frameLength);
+
+#endif
+static void AWGNChannel_addNoise(const emlrtStack *sp,
+  comm_internal_AWGNChannel *obj, const real_T b_std[3], creal_T b_u0[],
+  creal_T c_y0[], int32_T frameLength);
+static void AWGNChannel_addFadedNoise(const emlrtStack *sp,
+  comm_internal_AWGNChannel *obj, const real_T b_std[3], const creal_T b_x[],
+  const int32_T linkIds[6], creal_T c_y0[], int32_T frameLength);
 static void AWGNChannel_resetImpl(comm_internal_AWGNChannel *obj);
+static void AWGNChannel_seedTwister(comm_internal_AWGNChannel *obj);
 static real_T mt19937ar_mtziggurat(const emlrtStack *sp,
   coder_internal_mt19937ar *obj);
 static void mt19937ar_genrand_uint32_vector(coder_internal_mt19937ar *obj,
   uint32_T u[2]);
+static void mt19937ar_twist(uint32_T mt[625]);
+static void mt19937ar_seedState(uint32_T mt[625], const uint32_T seed[2]);
+static void mt19937ar_genrand_uint32_block(coder_internal_mt19937ar *obj,
+  uint32_T u[], int32_T n);
+static void mt19937ar_mtziggurat_block(const emlrtStack *sp,
+  coder_internal_mt19937ar *obj, real_T z[], int32_T n);
 static real_T mt19937ar_genrandu(const emlrtStack *sp, coder_internal_mt19937ar *
   obj);
 static boolean_T is_valid_state(uint32_T mt[625]);
-static real_T RandStream_zigguratGenrandn(const emlrtStack *sp,
-  coder_internal_RandStream *s);
 static void RandStream_rand(const emlrtStack *sp, coder_internal_RandStream *s,
   real_T u[2]);
 static real_T b_mt19937ar_genrandu(const emlrtStack *sp,
@@ -479,6 +626,23 @@ static real_T RandStream_polarGenrandn(const emlrtStack *sp,
   coder_internal_RandStream *rs);
 static real_T RandStream_inversionGenrandn(const emlrtStack *sp,
   coder_internal_RandStream *s);
+static void RandStream_zigguratGenrandnBlock(const emlrtStack *sp,
+  coder_internal_RandStream *s, real_T r[], int32_T n);
+static void RandStream_polarGenrandnBlock(const emlrtStack *sp,
+  coder_internal_RandStream *s, real_T r[], int32_T n);
+static void RandStream_inversionGenrandnBlock(const emlrtStack *sp,
+  coder_internal_RandStream *s, real_T r[], int32_T n);
+static void AWGNChannel_setupRandomStream(const emlrtStack *sp,
+  InstanceStruct_6ZqTk0OKN5QuhEtSrZC29B *moduleInstance,
+  comm_internal_AWGNChannel *obj);
+static uint32_T *AWGNChannel_legacyTwisterState(const emlrtStack *sp,
+  InstanceStruct_6ZqTk0OKN5QuhEtSrZC29B *moduleInstance);
+static void mul_wide_u32(uint32_T in0, uint32_T in1, uint32_T *ptrOutBitsHi,
+  uint32_T *ptrOutBitsLo);
+static void philox4x32_10(const uint32_T ctr[4], const uint32_T key[2],
+  uint32_T out[4]);
+static void RandStream_philoxGenrandnBlock(const emlrtStack *sp,
+  coder_internal_RandStream *s, real_T r[], int32_T n);
 static const mxArray *message(const emlrtStack *sp, const mxArray *m1, const
   mxArray *m2, emlrtMCInfo *location);
 static const mxArray *getString(const emlrtStack *sp, const mxArray *m1,
@@ -503,11 +667,37 @@ static void cgxe_mdl_start(InstanceStruct_6ZqTk0OKN5QuhEtSrZC29B *moduleInstance
   init_simulink_io_address(moduleInstance);
   b_EbNo = (real_T (*)[3])cgxertGetRunTimeParamInfoData(moduleInstance->S, 0);
   b_SignalPower = (real_T *)cgxertGetRunTimeParamInfoData(moduleInstance->S, 1);
-  st.tls = moduleInstance->emlrtRootTLSGlobal;
+  st.tls = moduleInstance->hot.emlrtRootTLSGlobal;
+  if ((ssGetInputPortWidth(moduleInstance->S, 0) < 3) || (ssGetInputPortWidth
+       (moduleInstance->S, 0) % 3 != 0)) {
+    emlrtErrorWithMessageIdR2018a(&st, &emlrtRTEI,
+      "comm:AWGNChannel:InvalidInputWidth",
+      "comm:AWGNChannel:InvalidInputWidth", 0);
+  }
+
+  if ((moduleInstance->hot.stdIn != NULL) && (ssGetInputPortWidth
+       (moduleInstance->S, 1) != 3)) {
+    emlrtErrorWithMessageIdR2018a(&st, &emlrtRTEI,
+      "comm:AWGNChannel:InvalidStdInputWidth",
+      "comm:AWGNChannel:InvalidStdInputWidth", 0);
+  }
+
   cgxertSetSimStateCompliance(moduleInstance->S, 4);
   cgxertSetGcb(moduleInstance->S, -1, -1);
   mw__internal__system__init__fcn(moduleInstance);
-  mw__internal__call__setup(moduleInstance, &st, *b_EbNo, *b_SignalPower);
+
+#ifdef AWGN_TSC_PROFILE
+
+  moduleInstance->sysobj.pTsc = &moduleInstance->tsc;
+
+#endif
+
+  {
+    AWGN_TSC_BEGIN(t0);
+    mw__internal__call__setup(moduleInstance, &st, *b_EbNo, *b_SignalPower);
+    AWGN_TSC_END(&moduleInstance->tsc, AWGN_TSC_SETUP, t0);
+  }
+
   cgxertRestoreGcb(moduleInstance->S, -1, -1);
 }
 
@@ -523,7 +713,7 @@ static void cgxe_mdl_initialize(InstanceStruct_6ZqTk0OKN5QuhEtSrZC29B
   real_T *b_SignalPower;
   b_EbNo = (real_T (*)[3])cgxertGetRunTimeParamInfoData(moduleInstance->S, 0);
   b_SignalPower = (real_T *)cgxertGetRunTimeParamInfoData(moduleInstance->S, 1);
-  st.tls = moduleInstance->emlrtRootTLSGlobal;
+  st.tls = moduleInstance->hot.emlrtRootTLSGlobal;
   emlrtLicenseCheckR2022a(&st, "EMLRT:runTime:MexFunctionNeedsLicense",
     "communication_toolbox", 2);
   cgxertSetGcb(moduleInstance->S, -1, -1);
@@ -543,10 +733,25 @@ static void cgxe_mdl_outputs(InstanceStruct_6ZqTk0OKN5QuhEtSrZC29B
   real_T *b_SignalPower;
   b_EbNo = (real_T (*)[3])cgxertGetRunTimeParamInfoData(moduleInstance->S, 0);
   b_SignalPower = (real_T *)cgxertGetRunTimeParamInfoData(moduleInstance->S, 1);
-  st.tls = moduleInstance->emlrtRootTLSGlobal;
+  st.tls = moduleInstance->hot.emlrtRootTLSGlobal;
   cgxertSetGcb(moduleInstance->S, -1, -1);
+  AWGN_TSC_BEGIN(t0);
+
+#ifdef AWGN_RELEASE_PROFILE
+
+  mw__internal__call__stepRelease(moduleInstance, &st, *b_EbNo, *b_SignalPower,
+    moduleInstance->hot.u0, moduleInstance->hot.b_y0, moduleInstance->hot.stdIn,
+    moduleInstance->hot.frameLength);
+
+#else
+
   mw__internal__call__step(moduleInstance, &st, *b_EbNo, *b_SignalPower,
-    *moduleInstance->u0, *moduleInstance->b_y0);
+    moduleInstance->hot.u0, moduleInstance->hot.b_y0, moduleInstance->hot.stdIn,
+    moduleInstance->hot.frameLength);
+
+#endif
+
+  AWGN_TSC_END(&moduleInstance->tsc, AWGN_TSC_STEP, t0);
   cgxertRestoreGcb(moduleInstance->S, -1, -1);
 }
 
@@ -578,128 +783,71 @@ static void cgxe_mdl_terminate(InstanceStruct_6ZqTk0OKN5QuhEtSrZC29B
   *moduleInstance)
 {
   cgxertSetGcb(moduleInstance->S, -1, -1);
+
+#ifdef AWGN_TSC_PROFILE
+
+  awgnTscReport(moduleInstance);
+
+#endif
+
   cgxertRestoreGcb(moduleInstance->S, -1, -1);
 }
 
-static void mw__internal__system__init__fcn
-  (InstanceStruct_6ZqTk0OKN5QuhEtSrZC29B *moduleInstance)
+#ifdef AWGN_TSC_PROFILE
+#if !defined(_MSC_VER) && !defined(__x86_64__) && !defined(__i386__)
+
+static uint64_T awgnTscReadClock(void)
+{
+  struct timespec ts;
+
+  /* No time stamp counter on this target: count nanoseconds instead */
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_T)ts.tv_sec * 1000000000UL + (uint64_T)ts.tv_nsec;
+}
+
+#endif
+
+static void awgnTscReport(InstanceStruct_6ZqTk0OKN5QuhEtSrZC29B *moduleInstance)
 {
-  static uint32_T uv[625] = { 5489U, 1301868182U, 2938499221U, 2950281878U,
-    1875628136U, 751856242U, 944701696U, 2243192071U, 694061057U, 219885934U,
-    2066767472U, 3182869408U, 485472502U, 2336857883U, 1071588843U, 3418470598U,
-    951210697U, 3693558366U, 2923482051U, 1793174584U, 2982310801U, 1586906132U,
-    1951078751U, 1808158765U, 1733897588U, 431328322U, 4202539044U, 530658942U,
-    1714810322U, 3025256284U, 3342585396U, 1937033938U, 2640572511U, 1654299090U,
-    3692403553U, 4233871309U, 3497650794U, 862629010U, 2943236032U, 2426458545U,
-    1603307207U, 1133453895U, 3099196360U, 2208657629U, 2747653927U, 931059398U,
-    761573964U, 3157853227U, 785880413U, 730313442U, 124945756U, 2937117055U,
-    3295982469U, 1724353043U, 3021675344U, 3884886417U, 4010150098U, 4056961966U,
-    699635835U, 2681338818U, 1339167484U, 720757518U, 2800161476U, 2376097373U,
-    1532957371U, 3902664099U, 1238982754U, 3725394514U, 3449176889U, 3570962471U,
-    4287636090U, 4087307012U, 3603343627U, 202242161U, 2995682783U, 1620962684U,
-    3704723357U, 371613603U, 2814834333U, 2111005706U, 624778151U, 2094172212U,
-    4284947003U, 1211977835U, 991917094U, 1570449747U, 2962370480U, 1259410321U,
-    170182696U, 146300961U, 2836829791U, 619452428U, 2723670296U, 1881399711U,
-    1161269684U, 1675188680U, 4132175277U, 780088327U, 3409462821U, 1036518241U,
-    1834958505U, 3048448173U, 161811569U, 618488316U, 44795092U, 3918322701U,
-    1924681712U, 3239478144U, 383254043U, 4042306580U, 2146983041U, 3992780527U,
-    3518029708U, 3545545436U, 3901231469U, 1896136409U, 2028528556U, 2339662006U,
-    501326714U, 2060962201U, 2502746480U, 561575027U, 581893337U, 3393774360U,
-    1778912547U, 3626131687U, 2175155826U, 319853231U, 986875531U, 819755096U,
-    2915734330U, 2688355739U, 3482074849U, 2736559U, 2296975761U, 1029741190U,
-    2876812646U, 690154749U, 579200347U, 4027461746U, 1285330465U, 2701024045U,
-    4117700889U, 759495121U, 3332270341U, 2313004527U, 2277067795U, 4131855432U,
-    2722057515U, 1264804546U, 3848622725U, 2211267957U, 4100593547U, 959123777U,
-    2130745407U, 3194437393U, 486673947U, 1377371204U, 17472727U, 352317554U,
-    3955548058U, 159652094U, 1232063192U, 3835177280U, 49423123U, 3083993636U,
-    733092U, 2120519771U, 2573409834U, 1112952433U, 3239502554U, 761045320U,
-    1087580692U, 2540165110U, 641058802U, 1792435497U, 2261799288U, 1579184083U,
-    627146892U, 2165744623U, 2200142389U, 2167590760U, 2381418376U, 1793358889U,
-    3081659520U, 1663384067U, 2009658756U, 2689600308U, 739136266U, 2304581039U,
-    3529067263U, 591360555U, 525209271U, 3131882996U, 294230224U, 2076220115U,
-    3113580446U, 1245621585U, 1386885462U, 3203270426U, 123512128U, 12350217U,
-    354956375U, 4282398238U, 3356876605U, 3888857667U, 157639694U, 2616064085U,
-    1563068963U, 2762125883U, 4045394511U, 4180452559U, 3294769488U, 1684529556U,
-    1002945951U, 3181438866U, 22506664U, 691783457U, 2685221343U, 171579916U,
-    3878728600U, 2475806724U, 2030324028U, 3331164912U, 1708711359U, 1970023127U,
-    2859691344U, 2588476477U, 2748146879U, 136111222U, 2967685492U, 909517429U,
-    2835297809U, 3206906216U, 3186870716U, 341264097U, 2542035121U, 3353277068U,
-    548223577U, 3170936588U, 1678403446U, 297435620U, 2337555430U, 466603495U,
-    1132321815U, 1208589219U, 696392160U, 894244439U, 2562678859U, 470224582U,
-    3306867480U, 201364898U, 2075966438U, 1767227936U, 2929737987U, 3674877796U,
-    2654196643U, 3692734598U, 3528895099U, 2796780123U, 3048728353U, 842329300U,
-    191554730U, 2922459673U, 3489020079U, 3979110629U, 1022523848U, 2202932467U,
-    3583655201U, 3565113719U, 587085778U, 4176046313U, 3013713762U, 950944241U,
-    396426791U, 3784844662U, 3477431613U, 3594592395U, 2782043838U, 3392093507U,
-    3106564952U, 2829419931U, 1358665591U, 2206918825U, 3170783123U, 31522386U,
-    2988194168U, 1782249537U, 1105080928U, 843500134U, 1225290080U, 1521001832U,
-    3605886097U, 2802786495U, 2728923319U, 3996284304U, 903417639U, 1171249804U,
-    1020374987U, 2824535874U, 423621996U, 1988534473U, 2493544470U, 1008604435U,
-    1756003503U, 1488867287U, 1386808992U, 732088248U, 1780630732U, 2482101014U,
-    976561178U, 1543448953U, 2602866064U, 2021139923U, 1952599828U, 2360242564U,
-    2117959962U, 2753061860U, 2388623612U, 4138193781U, 2962920654U, 2284970429U,
-    766920861U, 3457264692U, 2879611383U, 815055854U, 2332929068U, 1254853997U,
-    3740375268U, 3799380844U, 4091048725U, 2006331129U, 1982546212U, 686850534U,
-    1907447564U, 2682801776U, 2780821066U, 998290361U, 1342433871U, 4195430425U,
-    607905174U, 3902331779U, 2454067926U, 1708133115U, 1170874362U, 2008609376U,
-    3260320415U, 2211196135U, 433538229U, 2728786374U, 2189520818U, 262554063U,
-    1182318347U, 3710237267U, 1221022450U, 715966018U, 2417068910U, 2591870721U,
-    2870691989U, 3418190842U, 4238214053U, 1540704231U, 1575580968U, 2095917976U,
-    4078310857U, 2313532447U, 2110690783U, 4056346629U, 4061784526U, 1123218514U,
-    551538993U, 597148360U, 4120175196U, 3581618160U, 3181170517U, 422862282U,
-    3227524138U, 1713114790U, 662317149U, 1230418732U, 928171837U, 1324564878U,
-    1928816105U, 1786535431U, 2878099422U, 3290185549U, 539474248U, 1657512683U,
-    552370646U, 1671741683U, 3655312128U, 1552739510U, 2605208763U, 1441755014U,
-    181878989U, 3124053868U, 1447103986U, 3183906156U, 1728556020U, 3502241336U,
-    3055466967U, 1013272474U, 818402132U, 1715099063U, 2900113506U, 397254517U,
-    4194863039U, 1009068739U, 232864647U, 2540223708U, 2608288560U, 2415367765U,
-    478404847U, 3455100648U, 3182600021U, 2115988978U, 434269567U, 4117179324U,
-    3461774077U, 887256537U, 3545801025U, 286388911U, 3451742129U, 1981164769U,
-    786667016U, 3310123729U, 3097811076U, 2224235657U, 2959658883U, 3370969234U,
-    2514770915U, 3345656436U, 2677010851U, 2206236470U, 271648054U, 2342188545U,
-    4292848611U, 3646533909U, 3754009956U, 3803931226U, 4160647125U, 1477814055U,
-    4043852216U, 1876372354U, 3133294443U, 3871104810U, 3177020907U, 2074304428U,
-    3479393793U, 759562891U, 164128153U, 1839069216U, 2114162633U, 3989947309U,
-    3611054956U, 1333547922U, 835429831U, 494987340U, 171987910U, 1252001001U,
-    370809172U, 3508925425U, 2535703112U, 1276855041U, 1922855120U, 835673414U,
-    3030664304U, 613287117U, 171219893U, 3423096126U, 3376881639U, 2287770315U,
-    1658692645U, 1262815245U, 3957234326U, 1168096164U, 2968737525U, 2655813712U,
-    2132313144U, 3976047964U, 326516571U, 353088456U, 3679188938U, 3205649712U,
-    2654036126U, 1249024881U, 880166166U, 691800469U, 2229503665U, 1673458056U,
-    4032208375U, 1851778863U, 2563757330U, 376742205U, 1794655231U, 340247333U,
-    1505873033U, 396524441U, 879666767U, 3335579166U, 3260764261U, 3335999539U,
-    506221798U, 4214658741U, 975887814U, 2080536343U, 3360539560U, 571586418U,
-    138896374U, 4234352651U, 2737620262U, 3928362291U, 1516365296U, 38056726U,
-    3599462320U, 3585007266U, 3850961033U, 471667319U, 1536883193U, 2310166751U,
-    1861637689U, 2530999841U, 4139843801U, 2710569485U, 827578615U, 2012334720U,
-    2907369459U, 3029312804U, 2820112398U, 1965028045U, 35518606U, 2478379033U,
-    643747771U, 1924139484U, 4123405127U, 3811735531U, 3429660832U, 3285177704U,
-    1948416081U, 1311525291U, 1183517742U, 1739192232U, 3979815115U, 2567840007U,
-    4116821529U, 213304419U, 4125718577U, 1473064925U, 2442436592U, 1893310111U,
-    4195361916U, 3747569474U, 828465101U, 2991227658U, 750582866U, 1205170309U,
-    1409813056U, 678418130U, 1171531016U, 3821236156U, 354504587U, 4202874632U,
-    3882511497U, 1893248677U, 1903078632U, 26340130U, 2069166240U, 3657122492U,
-    3725758099U, 831344905U, 811453383U, 3447711422U, 2434543565U, 4166886888U,
-    3358210805U, 4142984013U, 2988152326U, 3527824853U, 982082992U, 2809155763U,
-    190157081U, 3340214818U, 2365432395U, 2548636180U, 2894533366U, 3474657421U,
-    2372634704U, 2845748389U, 43024175U, 2774226648U, 1987702864U, 3186502468U,
-    453610222U, 4204736567U, 1392892630U, 2471323686U, 2470534280U, 3541393095U,
-    4269885866U, 3909911300U, 759132955U, 1482612480U, 667715263U, 1795580598U,
-    2337923983U, 3390586366U, 581426223U, 1515718634U, 476374295U, 705213300U,
-    363062054U, 2084697697U, 2407503428U, 2292957699U, 2426213835U, 2199989172U,
-    1987356470U, 4026755612U, 2147252133U, 270400031U, 1367820199U, 2369854699U,
-    2844269403U, 79981964U, 624U };
+  static const char *phaseNames[AWGN_TSC_NUM_PHASES] = { "setup", "tunable",
+    "rng", "noise", "step" };
 
+  FILE *f;
+  const char *fileName;
   int32_T i;
-  for (i = 0; i < 625; i++) {
-    moduleInstance->state[i] = uv[i];
+
+  /* One line per instance: the cycles and the number of timed calls of */
+  /* each phase. rng and noise are timed per chunk of up to 256 samples. */
+  fileName = getenv("AWGN_TSC_PROFILE_FILE");
+  f = NULL;
+  if ((fileName != NULL) && (fileName[0] != '\0')) {
+    f = fopen(fileName, "a");
+  }
+
+  fprintf(f != NULL ? f : stderr, "awgn_tsc instance=%u",
+          (unsigned int)moduleInstance->sysobj.pInstanceID);
+  for (i = 0; i < AWGN_TSC_NUM_PHASES; i++) {
+    fprintf(f != NULL ? f : stderr, " %s=%llu/%llu", phaseNames[i],
+            (unsigned long long)moduleInstance->tsc.cycles[i],
+            (unsigned long long)moduleInstance->tsc.calls[i]);
+  }
+
+  fprintf(f != NULL ? f : stderr, "\n");
+  if (f != NULL) {
+    fclose(f);
   }
+}
 
+#endif
+
+static void mw__internal__system__init__fcn
+  (InstanceStruct_6ZqTk0OKN5QuhEtSrZC29B *moduleInstance)
+{
+  int32_T i;
   moduleInstance->seed = 0U;
   moduleInstance->seed_not_empty = true;
   moduleInstance->method = 7U;
   moduleInstance->method_not_empty = true;
-  moduleInstance->state_not_empty = true;
   for (i = 0; i < 2; i++) {
     moduleInstance->b_state[i] = 158852560U * (uint32_T)i + 362436069U;
   }
@@ -712,29 +860,16 @@ static void mw__internal__system__init__fcn
 static void mw__internal__call__setup(InstanceStruct_6ZqTk0OKN5QuhEtSrZC29B
   *moduleInstance, const emlrtStack *sp, real_T b_EbNo[3], real_T b_SignalPower)
 {
-  emlrtStack b_st;
-  emlrtStack c_st;
-  emlrtStack d_st;
-  emlrtStack e_st;
-  emlrtStack f_st;
   emlrtStack st;
   boolean_T flag;
   st.prev = sp;
   st.tls = sp->tls;
   if (!moduleInstance->sysobj_not_empty) {
     st.site = &g_emlrtRSI;
-    b_st.site = &emlrtRSI;
-    c_st.site = &b_emlrtRSI;
-    d_st.site = &c_emlrtRSI;
-    e_st.site = &d_emlrtRSI;
-    f_st.site = &e_emlrtRSI;
-    e_st.site = &d_emlrtRSI;
     moduleInstance->sysobj.TunablePropsChanged = false;
-    f_st.site = &f_emlrtRSI;
     moduleInstance->sysobj.isInitialized = 0;
     moduleInstance->sysobj_not_empty = true;
     st.site = &h_emlrtRSI;
-    b_st.site = &e_emlrtRSI;
     flag = (moduleInstance->sysobj.isInitialized == 1);
     if (flag) {
       moduleInstance->sysobj.TunablePropsChanged = true;
@@ -743,7 +878,6 @@ static void mw__internal__call__setup(InstanceStruct_6ZqTk0OKN5QuhEtSrZC29B
     st.site = &h_emlrtRSI;
     AWGNChannelBase_set_EbNo(&st, &moduleInstance->sysobj, b_EbNo);
     st.site = &i_emlrtRSI;
-    b_st.site = &e_emlrtRSI;
     flag = (moduleInstance->sysobj.isInitialized == 1);
     if (flag) {
       moduleInstance->sysobj.TunablePropsChanged = true;
@@ -1057,15 +1191,11 @@ static void SystemCore_setup(InstanceStruct_6ZqTk0OKN5QuhEtSrZC29B
 
   static char_T d_u[5] = { 's', 'e', 't', 'u', 'p' };
 
-  static int8_T iv1[8] = { 1, 3, 1, 1, 1, 1, 1, 1 };
-
   time_t b_eTime;
   time_t eTime;
   cell_wrap varSizes[1];
   emlrtStack b_st;
   emlrtStack c_st;
-  emlrtStack d_st;
-  emlrtStack e_st;
   emlrtStack st;
   const mxArray *b_y;
   const mxArray *c_y;
@@ -1077,6 +1207,7 @@ static void SystemCore_setup(InstanceStruct_6ZqTk0OKN5QuhEtSrZC29B
   real_T x;
   int32_T exitg1;
   int32_T mti;
+  uint32_T *legacyState;
   uint32_T r;
   char_T u[51];
   char_T e_u[49];
@@ -1119,79 +1250,106 @@ static void SystemCore_setup(InstanceStruct_6ZqTk0OKN5QuhEtSrZC29B
 
   obj->isInitialized = 1;
   st.site = &f_emlrtRSI;
-  for (mti = 0; mti < 8; mti++) {
-    varSizes[0].f1[mti] = (uint32_T)iv1[mti];
+  varSizes[0].f1[0] = (uint32_T)moduleInstance->hot.frameLength;
+  varSizes[0].f1[1] = 3U;
+  for (mti = 2; mti < 8; mti++) {
+    varSizes[0].f1[mti] = 1U;
   }
 
   obj->inputVarSize[0] = varSizes[0];
+  AWGNChannel_setupRandomStream(&st, moduleInstance, obj);
   st.site = &f_emlrtRSI;
   b_st.site = &n_emlrtRSI;
-  c_st.site = &r_emlrtRSI;
-  d_st.site = &s_emlrtRSI;
-  x = now() * 8.64E+6;
-  s = b_mod(muDoubleScalarFloor(x));
-  d_st.site = &t_emlrtRSI;
-  eTime = time(NULL);
-  do {
-    exitg1 = 0;
-    d_st.site = &u_emlrtRSI;
-    b_eTime = time(NULL);
-    if ((int32_T)b_eTime <= (int32_T)eTime + 1) {
-      d_st.site = &v_emlrtRSI;
-      x = now() * 8.64E+6;
-      if (s != b_mod(muDoubleScalarFloor(x))) {
+  if (obj->pHasSeed) {
+    /* An explicit seed makes setup reproducible and skips the wall-clock */
+    /* query and its wait for the clock to tick. */
+    moduleInstance->seed = obj->pSeed[0];
+  } else {
+    c_st.site = &r_emlrtRSI;
+    x = now() * 8.64E+6;
+    s = b_mod(muDoubleScalarFloor(x));
+    eTime = time(NULL);
+    do {
+      exitg1 = 0;
+      b_eTime = time(NULL);
+      if ((int32_T)b_eTime <= (int32_T)eTime + 1) {
+        x = now() * 8.64E+6;
+        if (s != b_mod(muDoubleScalarFloor(x))) {
+          exitg1 = 1;
+        }
+      } else {
         exitg1 = 1;
       }
-    } else {
-      exitg1 = 1;
-    }
-  } while (exitg1 == 0);
+    } while (exitg1 == 0);
 
-  x = muDoubleScalarRound(s);
-  if (x < 4.294967296E+9) {
-    if (x >= 0.0) {
-      moduleInstance->seed = (uint32_T)x;
+    x = muDoubleScalarRound(s);
+    if (x < 4.294967296E+9) {
+      if (x >= 0.0) {
+        moduleInstance->seed = (uint32_T)x;
+      } else {
+        moduleInstance->seed = 0U;
+      }
+    } else if (x >= 4.294967296E+9) {
+      moduleInstance->seed = MAX_uint32_T;
     } else {
       moduleInstance->seed = 0U;
     }
-  } else if (x >= 4.294967296E+9) {
-    moduleInstance->seed = MAX_uint32_T;
-  } else {
-    moduleInstance->seed = 0U;
   }
 
   c_st.site = &q_emlrtRSI;
-  r = moduleInstance->seed;
-  moduleInstance->state[0] = moduleInstance->seed;
-  for (mti = 0; mti < 623; mti++) {
-    r = ((r ^ r >> 30U) * 1812433253U + (uint32_T)mti) + 1U;
-    moduleInstance->state[mti + 1] = r;
-  }
+  if (moduleInstance->method == 7U) {
+    legacyState = AWGNChannel_legacyTwisterState(&c_st, moduleInstance);
+    if (legacyState != NULL) {
+      r = moduleInstance->seed;
+      legacyState[0] = moduleInstance->seed;
+      for (mti = 0; mti < 623; mti++) {
+        r = ((r ^ r >> 30U) * 1812433253U + (uint32_T)mti) + 1U;
+        legacyState[mti + 1] = r;
+      }
 
-  moduleInstance->state[624] = 624U;
+      legacyState[624] = 624U;
+    }
+  }
   b_st.site = &o_emlrtRSI;
   obj->pStream.SavedPolarValue = 0.0;
   obj->pStream.HaveSavedPolarValue = false;
   c_st.site = &w_emlrtRSI;
   c_st.site = &x_emlrtRSI;
-  d_st.site = &y_emlrtRSI;
-  e_st.site = &bb_emlrtRSI;
-  d_st.site = &ab_emlrtRSI;
-  obj->pStream.MtGenerator.Seed = 67U;
-  r = obj->pStream.MtGenerator.Seed;
-  obj->pStream.MtGenerator.State[0] = r;
-  for (mti = 0; mti < 623; mti++) {
-    r = ((r ^ r >> 30U) * 1812433253U + (uint32_T)mti) + 1U;
-    obj->pStream.MtGenerator.State[mti + 1] = r;
-  }
-
-  obj->pStream.MtGenerator.State[624] = 624U;
+  if (!obj->pHasSeed) {
+    obj->pSeed[0] = 67U;
+  }
+
   obj->pStream.Generator = &obj->pStream.MtGenerator;
+  AWGNChannel_seedTwister(obj);
   obj->pStream.NtMethod = coder_internal_RngNt_ziggurat;
+
+  /* Resolve the normal generator once so that step does not branch on */
+  /* NtMethod for every sample. */
+  if (obj->pStream.NtMethod == coder_internal_RngNt_ziggurat) {
+    obj->pRandnFcn = &RandStream_zigguratGenrandnBlock;
+  } else if (obj->pStream.NtMethod == coder_internal_RngNt_polar) {
+    obj->pRandnFcn = &RandStream_polarGenrandnBlock;
+  } else {
+    obj->pRandnFcn = &RandStream_inversionGenrandnBlock;
+  }
+
+  if (obj->pGenerator == comm_internal_AWGNGenerator_philox) {
+    obj->pRandnFcn = &RandStream_philoxGenrandnBlock;
+  }
+
+  obj->pStdCacheSignalPower = 0.0;
+  for (mti = 0; mti < 16; mti++) {
+    obj->pStdCacheValid[mti] = false;
+  }
   b_st.site = &p_emlrtRSI;
   obj->pNumChanFromProp = maximum(varargin_1);
   c_st.site = &cb_emlrtRSI;
   AWGNChannelBase_getStandardDeviation(&c_st, obj);
+  for (mti = 0; mti < 3; mti++) {
+    moduleInstance->hot.std[mti] = obj->pStd[mti];
+  }
+
+  moduleInstance->hot.generator = obj->pGenerator;
   if ((obj->pNumChanFromProp != 1.0) && (obj->pNumChanFromProp != 3.0)) {
     for (mti = 0; mti < 49; mti++) {
       e_u[mti] = f_u[mti];
@@ -1354,6 +1512,7 @@ static void AWGNChannelBase_getStandardDeviation(const emlrtStack *sp,
   real_T b[3];
   real_T b_std[3];
   real_T x;
+  int32_T idx[3];
   int32_T i;
   char_T u[30];
   char_T c_u[4];
@@ -1362,75 +1521,120 @@ static void AWGNChannelBase_getStandardDeviation(const emlrtStack *sp,
   st.tls = sp->tls;
   b_st.prev = &st;
   b_st.tls = st.tls;
-  x = obj->SignalPower;
-  for (i = 0; i < 3; i++) {
-    b[i] = obj->EbNo[i] / 10.0;
-  }
 
-  for (i = 0; i < 3; i++) {
-    b_std[i] = x / (muDoubleScalarPower(10.0, b[i]) * 2.0);
+  /* Memoize EbNo -> std in a small direct-mapped table so that sweeps */
+  /* revisiting Eb/No values skip the power and square root. Entries */
+  /* depend on SignalPower, so a SignalPower change flushes the table. */
+  /* Hits return exactly what the full computation below would. */
+  if (obj->pStdCacheSignalPower != obj->SignalPower) {
+    for (i = 0; i < 16; i++) {
+      obj->pStdCacheValid[i] = false;
+    }
+
+    obj->pStdCacheSignalPower = obj->SignalPower;
   }
 
-  st.site = &db_emlrtRSI;
-  p = false;
-  for (i = 0; i < 3; i++) {
-    if (p || (b_std[i] < 0.0)) {
-      p = true;
+  p = true;
+  i = 0;
+  while (p && (i < 3)) {
+    idx[i] = AWGNChannelBase_stdCacheIndex(obj->EbNo[i]);
+    if (obj->pStdCacheValid[idx[i]] && (obj->pStdCacheEbNo[idx[i]] ==
+         obj->EbNo[i])) {
+      i++;
     } else {
       p = false;
     }
   }
 
   if (p) {
-    for (i = 0; i < 30; i++) {
-      u[i] = b_u[i];
+    for (i = 0; i < 3; i++) {
+      obj->pStd[i] = obj->pStdCacheValue[idx[i]];
+    }
+  } else {
+    x = obj->SignalPower;
+    for (i = 0; i < 3; i++) {
+      b[i] = obj->EbNo[i] / 10.0;
     }
 
-    y = NULL;
-    m = emlrtCreateCharArray(2, &iv[0]);
-    emlrtInitCharArrayR2013a(&st, 30, m, &u[0]);
-    emlrtAssign(&y, m);
-    for (i = 0; i < 30; i++) {
-      u[i] = b_u[i];
+    for (i = 0; i < 3; i++) {
+      b_std[i] = x / (muDoubleScalarPower(10.0, b[i]) * 2.0);
     }
 
-    b_y = NULL;
-    m = emlrtCreateCharArray(2, &iv1[0]);
-    emlrtInitCharArrayR2013a(&st, 30, m, &u[0]);
-    emlrtAssign(&b_y, m);
-    for (i = 0; i < 4; i++) {
-      c_u[i] = d_u[i];
+    st.site = &db_emlrtRSI;
+    p = false;
+    for (i = 0; i < 3; i++) {
+      if (p || (b_std[i] < 0.0)) {
+        p = true;
+      } else {
+        p = false;
+      }
     }
 
-    c_y = NULL;
-    m = emlrtCreateCharArray(2, &iv2[0]);
-    emlrtInitCharArrayR2013a(&st, 4, m, &c_u[0]);
-    emlrtAssign(&c_y, m);
-    b_st.site = &nc_emlrtRSI;
-    error(&b_st, y, getString(&b_st, message(&b_st, b_y, c_y, &f_emlrtMCI),
-           &f_emlrtMCI), &f_emlrtMCI);
-  }
+    if (p) {
+      for (i = 0; i < 30; i++) {
+        u[i] = b_u[i];
+      }
 
-  for (i = 0; i <= 0; i += 2) {
-    r = _mm_loadu_pd(&b_std[0]);
-    _mm_storeu_pd(&b_std[0], _mm_sqrt_pd(r));
-  }
+      y = NULL;
+      m = emlrtCreateCharArray(2, &iv[0]);
+      emlrtInitCharArrayR2013a(&st, 30, m, &u[0]);
+      emlrtAssign(&y, m);
+      for (i = 0; i < 30; i++) {
+        u[i] = b_u[i];
+      }
 
-  for (i = 2; i < 3; i++) {
-    x = b_std[2];
-    x = muDoubleScalarSqrt(x);
-    b_std[2] = x;
-  }
+      b_y = NULL;
+      m = emlrtCreateCharArray(2, &iv1[0]);
+      emlrtInitCharArrayR2013a(&st, 30, m, &u[0]);
+      emlrtAssign(&b_y, m);
+      for (i = 0; i < 4; i++) {
+        c_u[i] = d_u[i];
+      }
 
-  for (i = 0; i < 3; i++) {
-    obj->pStd[i] = 0.0;
-  }
+      c_y = NULL;
+      m = emlrtCreateCharArray(2, &iv2[0]);
+      emlrtInitCharArrayR2013a(&st, 4, m, &c_u[0]);
+      emlrtAssign(&c_y, m);
+      b_st.site = &nc_emlrtRSI;
+      error(&b_st, y, getString(&b_st, message(&b_st, b_y, c_y, &f_emlrtMCI),
+             &f_emlrtMCI), &f_emlrtMCI);
+    }
 
-  for (i = 0; i < 3; i++) {
-    obj->pStd[i] = b_std[i];
+    for (i = 0; i <= 0; i += 2) {
+      r = _mm_loadu_pd(&b_std[0]);
+      _mm_storeu_pd(&b_std[0], _mm_sqrt_pd(r));
+    }
+
+    for (i = 2; i < 3; i++) {
+      x = b_std[2];
+      x = muDoubleScalarSqrt(x);
+      b_std[2] = x;
+    }
+
+    for (i = 0; i < 3; i++) {
+      obj->pStd[i] = 0.0;
+    }
+
+    for (i = 0; i < 3; i++) {
+      obj->pStd[i] = b_std[i];
+    }
+
+    for (i = 0; i < 3; i++) {
+      idx[i] = AWGNChannelBase_stdCacheIndex(obj->EbNo[i]);
+      obj->pStdCacheEbNo[idx[i]] = obj->EbNo[i];
+      obj->pStdCacheValue[idx[i]] = b_std[i];
+      obj->pStdCacheValid[idx[i]] = true;
+    }
   }
 }
 
+static int32_T AWGNChannelBase_stdCacheIndex(real_T b_EbNo)
+{
+  uint32_T w[2];
+  memcpy(&w[0], &b_EbNo, sizeof(real_T));
+  return (int32_T)(((w[0] ^ w[1]) * 2654435761U) >> 28U);
+}
+
 static void SystemCore_checkTunablePropChange(const emlrtStack *sp,
   comm_internal_AWGNChannel *obj)
 {
@@ -1500,10 +1704,6 @@ static void mw__internal__call__reset(InstanceStruct_6ZqTk0OKN5QuhEtSrZC29B
   static char_T f_u[5] = { 'r', 'e', 's', 'e', 't' };
 
   emlrtStack b_st;
-  emlrtStack c_st;
-  emlrtStack d_st;
-  emlrtStack e_st;
-  emlrtStack f_st;
   emlrtStack st;
   const mxArray *b_y;
   const mxArray *c_y;
@@ -1523,13 +1723,7 @@ static void mw__internal__call__reset(InstanceStruct_6ZqTk0OKN5QuhEtSrZC29B
   if (!moduleInstance->sysobj_not_empty) {
     st.site = &g_emlrtRSI;
     b_st.site = &emlrtRSI;
-    c_st.site = &b_emlrtRSI;
-    d_st.site = &c_emlrtRSI;
-    e_st.site = &d_emlrtRSI;
-    f_st.site = &e_emlrtRSI;
-    e_st.site = &d_emlrtRSI;
     moduleInstance->sysobj.TunablePropsChanged = false;
-    f_st.site = &f_emlrtRSI;
     moduleInstance->sysobj.isInitialized = 0;
     moduleInstance->sysobj_not_empty = true;
     st.site = &h_emlrtRSI;
@@ -1615,9 +1809,10 @@ static void mw__internal__call__reset(InstanceStruct_6ZqTk0OKN5QuhEtSrZC29B
   }
 }
 
-static void mw__internal__call__step(InstanceStruct_6ZqTk0OKN5QuhEtSrZC29B
-  *moduleInstance, const emlrtStack *sp, real_T b_EbNo[3], real_T b_SignalPower,
-  creal_T b_u0[3], creal_T c_y0[3])
+static AWGN_COLD void mw__internal__call__step
+  (InstanceStruct_6ZqTk0OKN5QuhEtSrZC29B *moduleInstance, const emlrtStack *sp,
+   real_T b_EbNo[3], real_T b_SignalPower, creal_T b_u0[], creal_T c_y0[], const
+   real_T stdIn[], int32_T frameLength)
 {
   static real_T varargin_1[4] = { 3.0, 1.0, 1.0, 1.0 };
 
@@ -1652,15 +1847,9 @@ static void mw__internal__call__step(InstanceStruct_6ZqTk0OKN5QuhEtSrZC29B
 
   static char_T h_u[4] = { 's', 't', 'e', 'p' };
 
-  static int8_T inSize[8] = { 1, 3, 1, 1, 1, 1, 1, 1 };
-
-  coder_internal_RandStream *s;
-  coder_internal_mt19937ar *obj;
   emlrtStack b_st;
   emlrtStack c_st;
   emlrtStack d_st;
-  emlrtStack e_st;
-  emlrtStack f_st;
   emlrtStack st;
   const mxArray *b_y;
   const mxArray *c_y;
@@ -1670,14 +1859,9 @@ static void mw__internal__call__step(InstanceStruct_6ZqTk0OKN5QuhEtSrZC29B
   const mxArray *g_y;
   const mxArray *m;
   const mxArray *y;
-  creal_T randData[3];
-  creal_T b_randData;
   real_T b_std[3];
-  real_T c;
-  real_T im;
-  real_T re;
-  coder_internal_RngNt nt;
   int32_T i;
+  uint32_T inSize[8];
   char_T d_u[53];
   char_T c_u[49];
   char_T u[45];
@@ -1693,20 +1877,12 @@ static void mw__internal__call__step(InstanceStruct_6ZqTk0OKN5QuhEtSrZC29B
   c_st.tls = b_st.tls;
   d_st.prev = &c_st;
   d_st.tls = c_st.tls;
-  e_st.prev = &d_st;
-  e_st.tls = d_st.tls;
-  f_st.prev = &e_st;
-  f_st.tls = e_st.tls;
   if (!moduleInstance->sysobj_not_empty) {
     st.site = &g_emlrtRSI;
     b_st.site = &emlrtRSI;
     c_st.site = &b_emlrtRSI;
     d_st.site = &c_emlrtRSI;
-    e_st.site = &d_emlrtRSI;
-    f_st.site = &e_emlrtRSI;
-    e_st.site = &d_emlrtRSI;
     moduleInstance->sysobj.TunablePropsChanged = false;
-    f_st.site = &f_emlrtRSI;
     moduleInstance->sysobj.isInitialized = 0;
     moduleInstance->sysobj_not_empty = true;
     st.site = &h_emlrtRSI;
@@ -1815,20 +1991,32 @@ static void mw__internal__call__step(InstanceStruct_6ZqTk0OKN5QuhEtSrZC29B
 
   b_st.site = &f_emlrtRSI;
   if (moduleInstance->sysobj.TunablePropsChanged) {
+    AWGN_TSC_BEGIN(t0);
     moduleInstance->sysobj.TunablePropsChanged = false;
     c_st.site = &f_emlrtRSI;
     moduleInstance->sysobj.pNumChanFromProp = maximum(varargin_1);
     d_st.site = &lb_emlrtRSI;
     AWGNChannelBase_getStandardDeviation(&d_st, &moduleInstance->sysobj);
+    for (i = 0; i < 3; i++) {
+      moduleInstance->hot.std[i] = moduleInstance->sysobj.pStd[i];
+    }
+
+    AWGN_TSC_END(&moduleInstance->tsc, AWGN_TSC_TUNABLE, t0);
   }
 
   b_st.site = &f_emlrtRSI;
+  inSize[0] = (uint32_T)frameLength;
+  inSize[1] = 3U;
+  for (i = 2; i < 8; i++) {
+    inSize[i] = 1U;
+  }
+
   i = 0;
   exitg1 = false;
   while ((!exitg1) && (i < 8)) {
-    if (moduleInstance->sysobj.inputVarSize[0].f1[i] != (uint32_T)inSize[i]) {
+    if (moduleInstance->sysobj.inputVarSize[0].f1[i] != inSize[i]) {
       for (i = 0; i < 8; i++) {
-        moduleInstance->sysobj.inputVarSize[0].f1[i] = (uint32_T)inSize[i];
+        moduleInstance->sysobj.inputVarSize[0].f1[i] = inSize[i];
       }
 
       exitg1 = true;
@@ -1889,46 +2077,134 @@ static void mw__internal__call__step(InstanceStruct_6ZqTk0OKN5QuhEtSrZC29B
            &h_emlrtMCI), &h_emlrtMCI);
   }
 
-  for (i = 0; i < 3; i++) {
-    b_std[i] = moduleInstance->sysobj.pStd[i];
-  }
-
-  c_st.site = &mb_emlrtRSI;
-  s = &moduleInstance->sysobj.pStream;
-  nt = moduleInstance->sysobj.pStream.NtMethod;
-  if (nt == coder_internal_RngNt_ziggurat) {
-    d_st.site = &nb_emlrtRSI;
-    obj = moduleInstance->sysobj.pStream.Generator;
+  /* When the optional second input port is connected, it carries the */
+  /* per-channel noise standard deviations and replaces the EbNo-derived */
+  /* values, so a per-step change costs only this copy and the check that */
+  /* every value is non-negative. */
+  if (stdIn != NULL) {
     for (i = 0; i < 3; i++) {
-      e_st.site = &pb_emlrtRSI;
-      im = mt19937ar_mtziggurat(&e_st, obj);
-      e_st.site = &qb_emlrtRSI;
-      c = mt19937ar_mtziggurat(&e_st, obj);
-      if (c == 0.0) {
-        re = im / 1.4142135623730951;
-        im = 0.0;
-      } else if (im == 0.0) {
-        re = 0.0;
-        im = c / 1.4142135623730951;
-      } else {
-        re = im / 1.4142135623730951;
-        im = c / 1.4142135623730951;
+      b_std[i] = stdIn[i];
+      if (!(stdIn[i] >= 0.0)) {
+        emlrtErrorWithMessageIdR2018a(sp, &emlrtRTEI,
+          "comm:AWGNChannel:InvalidStdInput",
+          "comm:AWGNChannel:InvalidStdInput", 0);
       }
+    }
+  } else {
+    for (i = 0; i < 3; i++) {
+      b_std[i] = moduleInstance->hot.std[i];
+    }
+  }
+
+  c_st.site = &mb_emlrtRSI;
+  d_st.site = &nb_emlrtRSI;
+  AWGNChannel_addNoise(&d_st, &moduleInstance->sysobj, b_std, b_u0, c_y0,
+                       frameLength);
+  b_st.site = &f_emlrtRSI;
+  {
+    AWGN_TSC_BEGIN(t0);
+    SystemCore_checkTunablePropChange(&b_st, &moduleInstance->sysobj);
+    AWGN_TSC_END(&moduleInstance->tsc, AWGN_TSC_TUNABLE, t0);
+  }
+}
 
-      b_randData.re = re;
-      b_randData.im = im;
-      randData[i] = b_randData;
+static boolean_T AWGNChannel_isSteadyState
+  (InstanceStruct_6ZqTk0OKN5QuhEtSrZC29B *moduleInstance, const real_T b_EbNo[3],
+   real_T b_SignalPower)
+{
+  comm_internal_AWGNChannel *obj;
+  int32_T i;
+  boolean_T p;
+
+  /* Steady state is: set up, no pending tunable change, same parameters */
+  /* and frame size as last step, a fixed 3-channel input and valid std */
+  /* input values. In that state the full step would only add noise. */
+  obj = &moduleInstance->sysobj;
+  p = (moduleInstance->sysobj_not_empty && (obj->isInitialized == 1) &&
+       (!obj->TunablePropsChanged) && (obj->SignalPower == b_SignalPower) &&
+       (!obj->pIsVarChannel) && (obj->pFirstInputNumChan == 3.0) &&
+       ((obj->pNumChanFromProp == 1.0) || (obj->pNumChanFromProp == 3.0)) &&
+       (obj->inputVarSize[0].f1[0] == (uint32_T)moduleInstance->hot.frameLength)
+       && (obj->inputVarSize[0].f1[1] == 3U));
+  for (i = 0; i < 3; i++) {
+    p = (p && (obj->EbNo[i] == b_EbNo[i]));
+    if (moduleInstance->hot.stdIn != NULL) {
+      p = (p && (moduleInstance->hot.stdIn[i] >= 0.0));
+    }
+  }
+
+  return p;
+}
+
+#ifdef AWGN_RELEASE_PROFILE
+
+static void mw__internal__call__stepRelease
+  (InstanceStruct_6ZqTk0OKN5QuhEtSrZC29B *moduleInstance, const emlrtStack *sp,
+   real_T b_EbNo[3], real_T b_SignalPower, creal_T b_u0[], creal_T c_y0[], const
+   real_T stdIn[], int32_T frameLength)
+{
+  /* Steady-state steps add the noise directly with the caller's root */
+  /* stack. Every other case runs the full step, which validates and */
+  /* reports as usual. */
+  if (AWGNChannel_isSteadyState(moduleInstance, b_EbNo, b_SignalPower)) {
+    if (stdIn != NULL) {
+      AWGNChannel_addNoise(sp, &moduleInstance->sysobj, stdIn, b_u0, c_y0,
+                           frameLength);
+    } else {
+      AWGNChannel_addNoise(sp, &moduleInstance->sysobj, moduleInstance->hot.std,
+                           b_u0, c_y0, frameLength);
     }
   } else {
-    d_st.site = &ob_emlrtRSI;
-    if (moduleInstance->sysobj.pStream.NtMethod == coder_internal_RngNt_ziggurat)
-    {
-      e_st.site = &wb_emlrtRSI;
-      for (i = 0; i < 3; i++) {
-        f_st.site = &ac_emlrtRSI;
-        re = RandStream_zigguratGenrandn(&f_st, s);
-        f_st.site = &bc_emlrtRSI;
-        im = RandStream_zigguratGenrandn(&f_st, s);
+    mw__internal__call__step(moduleInstance, sp, b_EbNo, b_SignalPower, b_u0,
+      c_y0, stdIn, frameLength);
+  }
+}
+
+#endif
+
+
+static void AWGNChannel_addNoise(const emlrtStack *sp,
+  comm_internal_AWGNChannel *obj, const real_T b_std[3], creal_T b_u0[],
+  creal_T c_y0[], int32_T frameLength)
+{
+  coder_internal_RandStream *s;
+  real_T randData[512];
+  real_T im;
+  real_T re;
+  int32_T i;
+  int32_T j;
+  int32_T k;
+  int32_T n;
+  int32_T nchunk;
+
+  /* The frame is an N-by-3 column-major buffer. Deviates are drawn in */
+  /* linear-index order so that a one-sample frame reproduces the */
+  /* per-sample stream exactly. Each channel column is filled in chunks */
+  /* of up to 256 complex samples from the generator resolved at setup. */
+  s = &obj->pStream;
+  k = 0;
+  for (i = 0; i < 3; i++) {
+    s->PhiloxCounter[0] = obj->pStepIndex[0];
+    s->PhiloxCounter[1] = obj->pStepIndex[1];
+    s->PhiloxCounter[2] = obj->pInstanceID << 2U | (uint32_T)i;
+    s->PhiloxCounter[3] = 0U;
+    n = 0;
+    while (n < frameLength) {
+      nchunk = frameLength - n;
+      if (nchunk > 256) {
+        nchunk = 256;
+      }
+
+      {
+        AWGN_TSC_BEGIN(t0);
+        obj->pRandnFcn(sp, s, &randData[0], nchunk << 1);
+        AWGN_TSC_END(obj->pTsc, AWGN_TSC_RNG, t0);
+      }
+
+      AWGN_TSC_BEGIN(t1);
+      for (j = 0; j < nchunk; j++) {
+        re = randData[j << 1];
+        im = randData[(j << 1) + 1];
         if (im == 0.0) {
           re /= 1.4142135623730951;
           im = 0.0;
@@ -1940,40 +2216,82 @@ static void mw__internal__call__step(InstanceStruct_6ZqTk0OKN5QuhEtSrZC29B
           im /= 1.4142135623730951;
         }
 
-        b_randData.re = re;
-        b_randData.im = im;
-        randData[i] = b_randData;
+        c_y0[k].re = b_u0[k].re + b_std[i] * re;
+        c_y0[k].im = b_u0[k].im + b_std[i] * im;
+        k++;
       }
-    } else if (moduleInstance->sysobj.pStream.NtMethod ==
-               coder_internal_RngNt_polar) {
-      e_st.site = &xb_emlrtRSI;
-      for (i = 0; i < 3; i++) {
-        f_st.site = &hc_emlrtRSI;
-        re = RandStream_polarGenrandn(&f_st, s);
-        f_st.site = &ic_emlrtRSI;
-        im = RandStream_polarGenrandn(&f_st, s);
-        if (im == 0.0) {
-          re /= 1.4142135623730951;
-          im = 0.0;
-        } else if (re == 0.0) {
-          re = 0.0;
-          im /= 1.4142135623730951;
-        } else {
-          re /= 1.4142135623730951;
-          im /= 1.4142135623730951;
+
+      AWGN_TSC_END(obj->pTsc, AWGN_TSC_NOISE, t1);
+
+      n += nchunk;
+    }
+  }
+
+  obj->pStepIndex[0]++;
+  if (obj->pStepIndex[0] == 0U) {
+    obj->pStepIndex[1]++;
+  }
+}
+
+static void AWGNChannel_addFadedNoise(const emlrtStack *sp,
+  comm_internal_AWGNChannel *obj, const real_T b_std[3], const creal_T b_x[],
+  const int32_T linkIds[6], creal_T c_y0[], int32_T frameLength)
+{
+  coder_internal_RandStream *s;
+  creal_T faded[256];
+  real_T randData[512];
+  real_T im;
+  real_T re;
+  int32_T i;
+  int32_T j;
+  int32_T k;
+  int32_T n;
+  int32_T nchunk;
+  int32_T tx;
+
+  /* Same as AWGNChannel_addNoise applied to the NetworkChannel output, */
+  /* but each 256-sample chunk of a receiver column is faded and noised */
+  /* while it is in cache, so the faded frame is never stored. b_x holds */
+  /* the three transmitted columns. linkIds is NetworkChannel's 3-by-2 */
+  /* pFadingIDs, where the link from tx to rx is column rx - 1 for tx < rx, */
+  /* and column rx otherwise. Chunks start at multiples of 256, which are */
+  /* also the fading engine's block boundaries, so the result is */
+  /* bit-identical to fading the whole frame first. */
+  s = &obj->pStream;
+  k = 0;
+  for (i = 0; i < 3; i++) {
+    s->PhiloxCounter[0] = obj->pStepIndex[0];
+    s->PhiloxCounter[1] = obj->pStepIndex[1];
+    s->PhiloxCounter[2] = obj->pInstanceID << 2U | (uint32_T)i;
+    s->PhiloxCounter[3] = 0U;
+    n = 0;
+    while (n < frameLength) {
+      nchunk = frameLength - n;
+      if (nchunk > 256) {
+        nchunk = 256;
+      }
+
+      memset(&faded[0], 0, (size_t)nchunk * sizeof(creal_T));
+      for (tx = 0; tx < 3; tx++) {
+        if (tx < i) {
+          networkFadingStep(linkIds[tx + 3 * (i - 1)], &b_x[tx * frameLength + n],
+                            &faded[0], nchunk, true);
+        } else if (tx > i) {
+          networkFadingStep(linkIds[tx + 3 * i], &b_x[tx * frameLength + n],
+                            &faded[0], nchunk, true);
         }
+      }
 
-        b_randData.re = re;
-        b_randData.im = im;
-        randData[i] = b_randData;
+      {
+        AWGN_TSC_BEGIN(t0);
+        obj->pRandnFcn(sp, s, &randData[0], nchunk << 1);
+        AWGN_TSC_END(obj->pTsc, AWGN_TSC_RNG, t0);
       }
-    } else {
-      e_st.site = &yb_emlrtRSI;
-      for (i = 0; i < 3; i++) {
-        f_st.site = &kc_emlrtRSI;
-        re = RandStream_inversionGenrandn(&f_st, s);
-        f_st.site = &lc_emlrtRSI;
-        im = RandStream_inversionGenrandn(&f_st, s);
+
+      AWGN_TSC_BEGIN(t1);
+      for (j = 0; j < nchunk; j++) {
+        re = randData[j << 1];
+        im = randData[(j << 1) + 1];
         if (im == 0.0) {
           re /= 1.4142135623730951;
           im = 0.0;
@@ -1985,120 +2303,55 @@ static void mw__internal__call__step(InstanceStruct_6ZqTk0OKN5QuhEtSrZC29B
           im /= 1.4142135623730951;
         }
 
-        b_randData.re = re;
-        b_randData.im = im;
-        randData[i] = b_randData;
+        c_y0[k].re = faded[j].re + b_std[i] * re;
+        c_y0[k].im = faded[j].im + b_std[i] * im;
+        k++;
       }
+
+      AWGN_TSC_END(obj->pTsc, AWGN_TSC_NOISE, t1);
+
+      n += nchunk;
     }
   }
 
-  for (i = 0; i < 3; i++) {
-    im = b_std[i];
-    c_y0[i].re = b_u0[i].re + im * randData[i].re;
-    c_y0[i].im = b_u0[i].im + im * randData[i].im;
+  obj->pStepIndex[0]++;
+  if (obj->pStepIndex[0] == 0U) {
+    obj->pStepIndex[1]++;
   }
-
-  b_st.site = &f_emlrtRSI;
-  SystemCore_checkTunablePropChange(&b_st, &moduleInstance->sysobj);
 }
 
 static void AWGNChannel_resetImpl(comm_internal_AWGNChannel *obj)
+{
+  AWGNChannel_seedTwister(obj);
+  obj->pStepIndex[0] = 0U;
+  obj->pStepIndex[1] = 0U;
+}
+
+static void AWGNChannel_seedTwister(comm_internal_AWGNChannel *obj)
 {
   coder_internal_mt19937ar *b_obj;
-  emlrtStack b_st;
-  emlrtStack st;
-  int32_T statei;
-  uint32_T nseed;
-  st.site = &ib_emlrtRSI;
-  b_st.site = &jb_emlrtRSI;
-  nseed = obj->pStream.Generator->Seed;
-  b_st.site = &kb_emlrtRSI;
+
+  /* Seeds the twister from the 64-bit pSeed, at setup and on every reset, */
+  /* so that a reset restarts the stream that setup started. The state */
+  /* after seeding is kept with its seed: a reset with the same seed */
+  /* copies it rather than running the 623-step initialization again. */
   b_obj = obj->pStream.Generator;
-  if (nseed == 0U) {
-    b_obj->Seed = 5489U;
+  b_obj->Seed = obj->pSeed[0];
+  if (obj->pSeedStateValid && (obj->pSeedStateKey[0] == obj->pSeed[0]) &&
+      (obj->pSeedStateKey[1] == obj->pSeed[1])) {
+    memcpy(&b_obj->State[0], &obj->pSeedState[0], 625U * sizeof(uint32_T));
   } else {
-    b_obj->Seed = nseed;
-  }
-
-  nseed = b_obj->Seed;
-  b_obj->State[0] = nseed;
-  for (statei = 0; statei < 623; statei++) {
-    nseed = ((nseed ^ nseed >> 30U) * 1812433253U + (uint32_T)statei) + 1U;
-    b_obj->State[statei + 1] = nseed;
+    mt19937ar_seedState(b_obj->State, obj->pSeed);
+    memcpy(&obj->pSeedState[0], &b_obj->State[0], 625U * sizeof(uint32_T));
+    obj->pSeedStateKey[0] = obj->pSeed[0];
+    obj->pSeedStateKey[1] = obj->pSeed[1];
+    obj->pSeedStateValid = true;
   }
-
-  b_obj->State[624] = 624U;
 }
 
 static real_T mt19937ar_mtziggurat(const emlrtStack *sp,
   coder_internal_mt19937ar *obj)
 {
-  static real_T dv[257] = { 0.0, 0.215241895984875, 0.286174591792068,
-    0.335737519214422, 0.375121332878378, 0.408389134611989, 0.43751840220787,
-    0.46363433679088, 0.487443966139235, 0.50942332960209, 0.529909720661557,
-    0.549151702327164, 0.567338257053817, 0.584616766106378, 0.601104617755991,
-    0.61689699000775, 0.63207223638606, 0.646695714894993, 0.660822574244419,
-    0.674499822837293, 0.687767892795788, 0.700661841106814, 0.713212285190975,
-    0.725446140909999, 0.737387211434295, 0.749056662017815, 0.760473406430107,
-    0.771654424224568, 0.782615023307232, 0.793369058840623, 0.80392911698997,
-    0.814306670135215, 0.824512208752291, 0.834555354086381, 0.844444954909153,
-    0.854189171008163, 0.863795545553308, 0.87327106808886, 0.882622229585165,
-    0.891855070732941, 0.900975224461221, 0.909987953496718, 0.91889818364959,
-    0.927710533401999, 0.936429340286575, 0.945058684468165, 0.953602409881086,
-    0.96206414322304, 0.970447311064224, 0.978755155294224, 0.986990747099062,
-    0.99515699963509, 1.00325667954467, 1.01129241744, 1.01926671746548,
-    1.02718196603564, 1.03504043983344, 1.04284431314415, 1.05059566459093,
-    1.05829648333067, 1.06594867476212, 1.07355406579244, 1.0811144097034,
-    1.08863139065398, 1.09610662785202, 1.10354167942464, 1.11093804601357,
-    1.11829717411934, 1.12562045921553, 1.13290924865253, 1.14016484436815,
-    1.14738850542085, 1.15458145035993, 1.16174485944561, 1.16887987673083,
-    1.17598761201545, 1.18306914268269, 1.19012551542669, 1.19715774787944,
-    1.20416683014438, 1.2111537262437, 1.21811937548548, 1.22506469375653,
-    1.23199057474614, 1.23889789110569, 1.24578749554863, 1.2526602218949,
-    1.25951688606371, 1.26635828701823, 1.27318520766536, 1.27999841571382,
-    1.28679866449324, 1.29358669373695, 1.30036323033084, 1.30712898903073,
-    1.31388467315022, 1.32063097522106, 1.32736857762793, 1.33409815321936,
-    1.3408203658964, 1.34753587118059, 1.35424531676263, 1.36094934303328,
-    1.36764858359748, 1.37434366577317, 1.38103521107586, 1.38772383568998,
-    1.39441015092814, 1.40109476367925, 1.4077782768464, 1.41446128977547,
-    1.42114439867531, 1.42782819703026, 1.43451327600589, 1.44120022484872,
-    1.44788963128058, 1.45458208188841, 1.46127816251028, 1.46797845861808,
-    1.47468355569786, 1.48139403962819, 1.48811049705745, 1.49483351578049,
-    1.50156368511546, 1.50830159628131, 1.51504784277671, 1.521803020761,
-    1.52856772943771, 1.53534257144151, 1.542128153229, 1.54892508547417,
-    1.55573398346918, 1.56255546753104, 1.56939016341512, 1.57623870273591,
-    1.58310172339603, 1.58997987002419, 1.59687379442279, 1.60378415602609,
-    1.61071162236983, 1.61765686957301, 1.62462058283303, 1.63160345693487,
-    1.63860619677555, 1.64562951790478, 1.65267414708306, 1.65974082285818,
-    1.66683029616166, 1.67394333092612, 1.68108070472517, 1.68824320943719,
-    1.69543165193456, 1.70264685479992, 1.7098896570713, 1.71716091501782,
-    1.72446150294804, 1.73179231405296, 1.73915426128591, 1.74654827828172,
-    1.75397532031767, 1.76143636531891, 1.76893241491127, 1.77646449552452,
-    1.78403365954944, 1.79164098655216, 1.79928758454972, 1.80697459135082,
-    1.81470317596628, 1.82247454009388, 1.83028991968276, 1.83815058658281,
-    1.84605785028518, 1.8540130597602, 1.86201760539967, 1.87007292107127,
-    1.878180486293, 1.88634182853678, 1.8945585256707, 1.90283220855043,
-    1.91116456377125, 1.91955733659319, 1.92801233405266, 1.93653142827569,
-    1.94511656000868, 1.95376974238465, 1.96249306494436, 1.97128869793366,
-    1.98015889690048, 1.98910600761744, 1.99813247135842, 2.00724083056053,
-    2.0164337349062, 2.02571394786385, 2.03508435372962, 2.04454796521753,
-    2.05410793165065, 2.06376754781173, 2.07353026351874, 2.0833996939983,
-    2.09337963113879, 2.10347405571488, 2.11368715068665, 2.12402331568952,
-    2.13448718284602, 2.14508363404789, 2.15581781987674, 2.16669518035431,
-    2.17772146774029, 2.18890277162636, 2.20024554661128, 2.21175664288416,
-    2.22344334009251, 2.23531338492992, 2.24737503294739, 2.25963709517379,
-    2.27210899022838, 2.28480080272449, 2.29772334890286, 2.31088825060137,
-    2.32430801887113, 2.33799614879653, 2.35196722737914, 2.36623705671729,
-    2.38082279517208, 2.39574311978193, 2.41101841390112, 2.42667098493715,
-    2.44272531820036, 2.4592083743347, 2.47614993967052, 2.49358304127105,
-    2.51154444162669, 2.53007523215985, 2.54922155032478, 2.56903545268184,
-    2.58957598670829, 2.61091051848882, 2.63311639363158, 2.65628303757674,
-    2.68051464328574, 2.70593365612306, 2.73268535904401, 2.76094400527999,
-    2.79092117400193, 2.82287739682644, 2.85713873087322, 2.89412105361341,
-    2.93436686720889, 2.97860327988184, 3.02783779176959, 3.08352613200214,
-    3.147889289518, 3.2245750520478, 3.32024473383983, 3.44927829856143,
-    3.65415288536101, 3.91075795952492 };
-
   static real_T dv1[257] = { 1.0, 0.977101701267673, 0.959879091800108,
     0.9451989534423, 0.932060075959231, 0.919991505039348, 0.908726440052131,
     0.898095921898344, 0.887984660755834, 0.878309655808918, 0.869008688036857,
@@ -2184,8 +2437,8 @@ static real_T mt19937ar_mtziggurat(const emlrtStack *sp,
     mt19937ar_genrand_uint32_vector(obj, u32);
     i = (int32_T)((u32[1] >> 24U) + 1U);
     z = (((real_T)(u32[0] >> 3U) * 1.6777216E+7 + (real_T)((int32_T)u32[1] &
-           16777215)) * 2.2204460492503131E-16 - 1.0) * dv[i];
-    if (muDoubleScalarAbs(z) <= dv[i - 1]) {
+           16777215)) * 2.2204460492503131E-16 - 1.0) * mtziggurat_x[i];
+    if (muDoubleScalarAbs(z) <= mtziggurat_x[i - 1]) {
       exitg1 = 1;
     } else if (i < 256) {
       st.site = &sb_emlrtRSI;
@@ -2216,60 +2469,320 @@ static real_T mt19937ar_mtziggurat(const emlrtStack *sp,
   return z;
 }
 
+static void mt19937ar_mtziggurat_block(const emlrtStack *sp,
+  coder_internal_mt19937ar *obj, real_T z[], int32_T n)
+{
+  __m128d r;
+  emlrtStack st;
+  int32_T i;
+  int32_T i1;
+  int32_T k;
+  int32_T m;
+  int32_T mask;
+  int32_T p;
+  uint32_T mti;
+  uint32_T u32[624];
+  boolean_T rejected;
+  st.prev = sp;
+  st.tls = sp->tls;
+
+  /* Fills z with n standard normal deviates, consuming the generator */
+  /* exactly like n calls to mt19937ar_mtziggurat. Each deviate reads one */
+  /* pair of words. The pairs left in the current state block are tempered */
+  /* in bulk, and the fast ziggurat test runs on two lanes at a time. */
+  /* When a lane fails the test, consumption is rewound to that lane's pair */
+  /* and the scalar generator runs the rare wedge/tail path. The output is */
+  /* therefore bit-identical to the scalar generator on every path. */
+  for (p = 0; p < 257; p += 8) {
+    _mm_prefetch((const char *)&mtziggurat_x[p], _MM_HINT_T0);
+  }
+
+  k = 0;
+  while (k < n) {
+    mti = obj->State[624];
+    if (mti >= 624U) {
+      mt19937ar_twist(obj->State);
+      mti = 0U;
+      obj->State[624] = 0U;
+    }
+
+    m = (int32_T)((624U - mti) >> 1U);
+    if (m > n - k) {
+      m = n - k;
+    }
+
+    if (m == 0) {
+      /* A single word is left in the block: the pair straddles a twist. */
+      st.site = &rb_emlrtRSI;
+      z[k] = mt19937ar_mtziggurat(&st, obj);
+      k++;
+    } else {
+      mt19937ar_genrand_uint32_block(obj, u32, m << 1);
+      rejected = false;
+      p = 0;
+      while ((!rejected) && (p + 2 <= m)) {
+        i = (int32_T)((u32[(p << 1) + 1] >> 24U) + 1U);
+        i1 = (int32_T)((u32[(p << 1) + 3] >> 24U) + 1U);
+        r = _mm_mul_pd(_mm_sub_pd(_mm_mul_pd(_mm_add_pd(_mm_mul_pd(_mm_set_pd
+          ((real_T)(u32[(p << 1) + 2] >> 3U), (real_T)(u32[p << 1] >> 3U)),
+          _mm_set1_pd(1.6777216E+7)), _mm_set_pd((real_T)((int32_T)u32[(p << 1)
+          + 3] & 16777215), (real_T)((int32_T)u32[(p << 1) + 1] & 16777215))),
+          _mm_set1_pd(2.2204460492503131E-16)), _mm_set1_pd(1.0)), _mm_set_pd
+                       (mtziggurat_x[i1], mtziggurat_x[i]));
+        mask = _mm_movemask_pd(_mm_cmple_pd(_mm_andnot_pd(_mm_set1_pd(-0.0), r),
+          _mm_set_pd(mtziggurat_x[i1 - 1], mtziggurat_x[i - 1])));
+        _mm_storeu_pd(&z[k + p], r);
+        if (mask == 3) {
+          p += 2;
+        } else {
+          if ((mask & 1) != 0) {
+            p++;
+          }
+
+          rejected = true;
+        }
+      }
+
+      if ((!rejected) && (p < m)) {
+        i = (int32_T)((u32[(p << 1) + 1] >> 24U) + 1U);
+        z[k + p] = (((real_T)(u32[p << 1] >> 3U) * 1.6777216E+7 + (real_T)
+                     ((int32_T)u32[(p << 1) + 1] & 16777215)) *
+                    2.2204460492503131E-16 - 1.0) * mtziggurat_x[i];
+        if (muDoubleScalarAbs(z[k + p]) <= mtziggurat_x[i - 1]) {
+          p++;
+        } else {
+          rejected = true;
+        }
+      }
+
+      if (rejected) {
+        obj->State[624] = mti + ((uint32_T)p << 1U);
+        st.site = &rb_emlrtRSI;
+        z[k + p] = mt19937ar_mtziggurat(&st, obj);
+        p++;
+      }
+
+      k += p;
+    }
+  }
+}
+
 static void mt19937ar_genrand_uint32_vector(coder_internal_mt19937ar *obj,
   uint32_T u[2])
 {
-  int32_T j;
+  mt19937ar_genrand_uint32_block(obj, u, 2);
+}
+
+static void mt19937ar_twist(uint32_T mt[625])
+{
+  __m128i r;
+  __m128i r1;
+  __m128i r2;
+  __m128i r3;
   int32_T kk;
-  uint32_T statei;
   uint32_T y;
-  for (j = 0; j < 2; j++) {
-    statei = obj->State[624] + 1U;
-    if (statei >= 625U) {
-      for (kk = 0; kk < 227; kk++) {
-        y = (obj->State[kk] & 2147483648U) | (obj->State[kk + 1] & 2147483647U);
-        if ((y & 1U) == 0U) {
-          y >>= 1U;
-        } else {
-          y = y >> 1U ^ 2567483615U;
-        }
 
-        obj->State[kk] = obj->State[kk + 397] ^ y;
+#ifdef __AVX2__
+
+  __m256i b_r;
+  __m256i b_r1;
+  __m256i b_r2;
+  __m256i b_r3;
+
+#endif
+
+  /* Regenerates all 624 words of the MT19937 state. The twist is made */
+  /* branchless by turning the low bit of y into an all-ones mask for */
+  /* MATRIX_A. Both loops can be vectorized: a lane in the first loop only */
+  /* reads words at kk + 397 or above, which that loop never writes, and a */
+  /* lane in the second loop reads words at kk - 227, which were written */
+  /* more than one vector earlier. The result is bit-identical to the */
+  /* scalar recurrence. The bounds are fixed: the first loop covers words */
+  /* 0 to 223 in vectors and 224 to 226 in scalars, and the 396 words of */
+  /* the second loop are a whole number of 4-word vectors, after 49 8-word */
+  /* vectors with AVX2, so it has no scalar tail. */
+  kk = 0;
+
+#ifdef __AVX2__
+
+  for (; kk < 224; kk += 8) {
+    b_r = _mm256_or_si256(_mm256_and_si256(_mm256_loadu_si256((const __m256i *)
+      &mt[kk]), _mm256_set1_epi32((int32_T)2147483648U)), _mm256_and_si256
+                          (_mm256_loadu_si256((const __m256i *)&mt[kk + 1]),
+      _mm256_set1_epi32(2147483647)));
+    b_r1 = _mm256_and_si256(_mm256_srai_epi32(_mm256_slli_epi32(b_r, 31), 31),
+      _mm256_set1_epi32((int32_T)2567483615U));
+    b_r2 = _mm256_xor_si256(_mm256_srli_epi32(b_r, 1), b_r1);
+    b_r3 = _mm256_loadu_si256((const __m256i *)&mt[kk + 397]);
+    _mm256_storeu_si256((__m256i *)&mt[kk], _mm256_xor_si256(b_r3, b_r2));
+  }
+
+#endif
+
+  for (; kk < 224; kk += 4) {
+    r = _mm_or_si128(_mm_and_si128(_mm_loadu_si128((const __m128i *)&mt[kk]),
+      _mm_set1_epi32((int32_T)2147483648U)), _mm_and_si128(_mm_loadu_si128((
+      const __m128i *)&mt[kk + 1]), _mm_set1_epi32(2147483647)));
+    r1 = _mm_and_si128(_mm_srai_epi32(_mm_slli_epi32(r, 31), 31),
+                       _mm_set1_epi32((int32_T)2567483615U));
+    r2 = _mm_xor_si128(_mm_srli_epi32(r, 1), r1);
+    r3 = _mm_loadu_si128((const __m128i *)&mt[kk + 397]);
+    _mm_storeu_si128((__m128i *)&mt[kk], _mm_xor_si128(r3, r2));
+  }
+
+  for (; kk < 227; kk++) {
+    y = (mt[kk] & 2147483648U) | (mt[kk + 1] & 2147483647U);
+    mt[kk] = mt[kk + 397] ^ ((y >> 1U) ^ ((0U - (y & 1U)) & 2567483615U));
+  }
+
+#ifdef __AVX2__
+
+  for (; kk < 619; kk += 8) {
+    b_r = _mm256_or_si256(_mm256_and_si256(_mm256_loadu_si256((const __m256i *)
+      &mt[kk]), _mm256_set1_epi32((int32_T)2147483648U)), _mm256_and_si256
+                          (_mm256_loadu_si256((const __m256i *)&mt[kk + 1]),
+      _mm256_set1_epi32(2147483647)));
+    b_r1 = _mm256_and_si256(_mm256_srai_epi32(_mm256_slli_epi32(b_r, 31), 31),
+      _mm256_set1_epi32((int32_T)2567483615U));
+    b_r2 = _mm256_xor_si256(_mm256_srli_epi32(b_r, 1), b_r1);
+    b_r3 = _mm256_loadu_si256((const __m256i *)&mt[kk - 227]);
+    _mm256_storeu_si256((__m256i *)&mt[kk], _mm256_xor_si256(b_r3, b_r2));
+  }
+
+#endif
+
+  for (; kk < 623; kk += 4) {
+    r = _mm_or_si128(_mm_and_si128(_mm_loadu_si128((const __m128i *)&mt[kk]),
+      _mm_set1_epi32((int32_T)2147483648U)), _mm_and_si128(_mm_loadu_si128((
+      const __m128i *)&mt[kk + 1]), _mm_set1_epi32(2147483647)));
+    r1 = _mm_and_si128(_mm_srai_epi32(_mm_slli_epi32(r, 31), 31),
+                       _mm_set1_epi32((int32_T)2567483615U));
+    r2 = _mm_xor_si128(_mm_srli_epi32(r, 1), r1);
+    r3 = _mm_loadu_si128((const __m128i *)&mt[kk - 227]);
+    _mm_storeu_si128((__m128i *)&mt[kk], _mm_xor_si128(r3, r2));
+  }
+
+  y = (mt[623] & 2147483648U) | (mt[0] & 2147483647U);
+  mt[623] = mt[396] ^ ((y >> 1U) ^ ((0U - (y & 1U)) & 2567483615U));
+}
+
+static void mt19937ar_seedState(uint32_T mt[625], const uint32_T seed[2])
+{
+  int32_T i;
+  int32_T j;
+  int32_T k;
+  uint32_T r;
+
+  /* Initializes mt for a 64-bit seed. Seeds below 2^32 use init_genrand, */
+  /* as rng(seed) does; larger seeds use init_by_array on {lo, hi}. A zero */
+  /* seed maps to 5489, the mt19937ar default, whose state is the constant */
+  /* mt19937ar_state5489 and is copied instead of initialized. */
+  if ((seed[1] == 0U) && ((seed[0] == 0U) || (seed[0] == 5489U))) {
+    memcpy(&mt[0], &mt19937ar_state5489[0], 625U * sizeof(uint32_T));
+  } else {
+    if (seed[1] == 0U) {
+      r = seed[0];
+      mt[0] = r;
+      for (i = 0; i < 623; i++) {
+        r = ((r ^ r >> 30U) * 1812433253U + (uint32_T)i) + 1U;
+        mt[i + 1] = r;
+      }
+    } else {
+      r = 19650218U;
+      mt[0] = r;
+      for (i = 0; i < 623; i++) {
+        r = ((r ^ r >> 30U) * 1812433253U + (uint32_T)i) + 1U;
+        mt[i + 1] = r;
       }
 
-      for (kk = 0; kk < 396; kk++) {
-        y = (obj->State[kk + 227] & 2147483648U) | (obj->State[kk + 228] &
-          2147483647U);
-        if ((y & 1U) == 0U) {
-          y >>= 1U;
-        } else {
-          y = y >> 1U ^ 2567483615U;
+      i = 1;
+      j = 0;
+      for (k = 624; k > 0; k--) {
+        mt[i] = ((mt[i] ^ (mt[i - 1] ^ mt[i - 1] >> 30U) * 1664525U) + seed[j])
+          + (uint32_T)j;
+        i++;
+        j++;
+        if (i >= 624) {
+          mt[0] = mt[623];
+          i = 1;
         }
 
-        obj->State[kk + 227] = obj->State[kk] ^ y;
+        if (j >= 2) {
+          j = 0;
+        }
       }
 
-      y = (obj->State[623] & 2147483648U) | (obj->State[0] & 2147483647U);
-      if ((y & 1U) == 0U) {
-        y >>= 1U;
-      } else {
-        y = y >> 1U ^ 2567483615U;
+      for (k = 623; k > 0; k--) {
+        mt[i] = (mt[i] ^ (mt[i - 1] ^ mt[i - 1] >> 30U) * 1566083941U) -
+          (uint32_T)i;
+        i++;
+        if (i >= 624) {
+          mt[0] = mt[623];
+          i = 1;
+        }
       }
 
-      obj->State[623] = obj->State[396] ^ y;
-      statei = 1U;
+      mt[0] = 2147483648U;
     }
 
-    y = obj->State[(int32_T)statei - 1];
-    obj->State[624] = statei;
-    y ^= y >> 11U;
-    y ^= y << 7U & 2636928640U;
-    y ^= y << 15U & 4022730752U;
-    y ^= y >> 18U;
-    u[j] = y;
+    mt[624] = 624U;
   }
 }
 
+static void mt19937ar_genrand_uint32_block(coder_internal_mt19937ar *obj,
+  uint32_T u[], int32_T n)
+{
+  __m128i r;
+  int32_T j;
+  int32_T k;
+  int32_T m;
+  uint32_T mti;
+  uint32_T y;
+
+  /* Fills u with the next n tempered words of the stream. State[624] */
+  /* holds the number of words already consumed from the current block, so */
+  /* the sequence and the final state match n single-word draws exactly. */
+  mti = obj->State[624];
+  j = 0;
+  while (j < n) {
+    if (mti >= 624U) {
+      mt19937ar_twist(obj->State);
+      mti = 0U;
+    }
+
+    m = 624 - (int32_T)mti;
+    if (m > n - j) {
+      m = n - j;
+    }
+
+    k = 0;
+    for (; k + 4 <= m; k += 4) {
+      r = _mm_loadu_si128((const __m128i *)&obj->State[mti + (uint32_T)k]);
+      r = _mm_xor_si128(r, _mm_srli_epi32(r, 11));
+      r = _mm_xor_si128(r, _mm_and_si128(_mm_slli_epi32(r, 7), _mm_set1_epi32
+        ((int32_T)2636928640U)));
+      r = _mm_xor_si128(r, _mm_and_si128(_mm_slli_epi32(r, 15), _mm_set1_epi32
+        ((int32_T)4022730752U)));
+      r = _mm_xor_si128(r, _mm_srli_epi32(r, 18));
+      _mm_storeu_si128((__m128i *)&u[j + k], r);
+    }
+
+    for (; k < m; k++) {
+      y = obj->State[mti + (uint32_T)k];
+      y ^= y >> 11U;
+      y ^= y << 7U & 2636928640U;
+      y ^= y << 15U & 4022730752U;
+      y ^= y >> 18U;
+      u[j + k] = y;
+    }
+
+    mti += (uint32_T)m;
+    j += m;
+  }
+
+  obj->State[624] = mti;
+}
+
 static real_T mt19937ar_genrandu(const emlrtStack *sp, coder_internal_mt19937ar *
   obj)
 {
@@ -2396,188 +2909,6 @@ static boolean_T is_valid_state(uint32_T mt[625])
   return isvalid;
 }
 
-static real_T RandStream_zigguratGenrandn(const emlrtStack *sp,
-  coder_internal_RandStream *s)
-{
-  static real_T dv[257] = { 0.0, 0.215241895984875, 0.286174591792068,
-    0.335737519214422, 0.375121332878378, 0.408389134611989, 0.43751840220787,
-    0.46363433679088, 0.487443966139235, 0.50942332960209, 0.529909720661557,
-    0.549151702327164, 0.567338257053817, 0.584616766106378, 0.601104617755991,
-    0.61689699000775, 0.63207223638606, 0.646695714894993, 0.660822574244419,
-    0.674499822837293, 0.687767892795788, 0.700661841106814, 0.713212285190975,
-    0.725446140909999, 0.737387211434295, 0.749056662017815, 0.760473406430107,
-    0.771654424224568, 0.782615023307232, 0.793369058840623, 0.80392911698997,
-    0.814306670135215, 0.824512208752291, 0.834555354086381, 0.844444954909153,
-    0.854189171008163, 0.863795545553308, 0.87327106808886, 0.882622229585165,
-    0.891855070732941, 0.900975224461221, 0.909987953496718, 0.91889818364959,
-    0.927710533401999, 0.936429340286575, 0.945058684468165, 0.953602409881086,
-    0.96206414322304, 0.970447311064224, 0.978755155294224, 0.986990747099062,
-    0.99515699963509, 1.00325667954467, 1.01129241744, 1.01926671746548,
-    1.02718196603564, 1.03504043983344, 1.04284431314415, 1.05059566459093,
-    1.05829648333067, 1.06594867476212, 1.07355406579244, 1.0811144097034,
-    1.08863139065398, 1.09610662785202, 1.10354167942464, 1.11093804601357,
-    1.11829717411934, 1.12562045921553, 1.13290924865253, 1.14016484436815,
-    1.14738850542085, 1.15458145035993, 1.16174485944561, 1.16887987673083,
-    1.17598761201545, 1.18306914268269, 1.19012551542669, 1.19715774787944,
-    1.20416683014438, 1.2111537262437, 1.21811937548548, 1.22506469375653,
-    1.23199057474614, 1.23889789110569, 1.24578749554863, 1.2526602218949,
-    1.25951688606371, 1.26635828701823, 1.27318520766536, 1.27999841571382,
-    1.28679866449324, 1.29358669373695, 1.30036323033084, 1.30712898903073,
-    1.31388467315022, 1.32063097522106, 1.32736857762793, 1.33409815321936,
-    1.3408203658964, 1.34753587118059, 1.35424531676263, 1.36094934303328,
-    1.36764858359748, 1.37434366577317, 1.38103521107586, 1.38772383568998,
-    1.39441015092814, 1.40109476367925, 1.4077782768464, 1.41446128977547,
-    1.42114439867531, 1.42782819703026, 1.43451327600589, 1.44120022484872,
-    1.44788963128058, 1.45458208188841, 1.46127816251028, 1.46797845861808,
-    1.47468355569786, 1.48139403962819, 1.48811049705745, 1.49483351578049,
-    1.50156368511546, 1.50830159628131, 1.51504784277671, 1.521803020761,
-    1.52856772943771, 1.53534257144151, 1.542128153229, 1.54892508547417,
-    1.55573398346918, 1.56255546753104, 1.56939016341512, 1.57623870273591,
-    1.58310172339603, 1.58997987002419, 1.59687379442279, 1.60378415602609,
-    1.61071162236983, 1.61765686957301, 1.62462058283303, 1.63160345693487,
-    1.63860619677555, 1.64562951790478, 1.65267414708306, 1.65974082285818,
-    1.66683029616166, 1.67394333092612, 1.68108070472517, 1.68824320943719,
-    1.69543165193456, 1.70264685479992, 1.7098896570713, 1.71716091501782,
-    1.72446150294804, 1.73179231405296, 1.73915426128591, 1.74654827828172,
-    1.75397532031767, 1.76143636531891, 1.76893241491127, 1.77646449552452,
-    1.78403365954944, 1.79164098655216, 1.79928758454972, 1.80697459135082,
-    1.81470317596628, 1.82247454009388, 1.83028991968276, 1.83815058658281,
-    1.84605785028518, 1.8540130597602, 1.86201760539967, 1.87007292107127,
-    1.878180486293, 1.88634182853678, 1.8945585256707, 1.90283220855043,
-    1.91116456377125, 1.91955733659319, 1.92801233405266, 1.93653142827569,
-    1.94511656000868, 1.95376974238465, 1.96249306494436, 1.97128869793366,
-    1.98015889690048, 1.98910600761744, 1.99813247135842, 2.00724083056053,
-    2.0164337349062, 2.02571394786385, 2.03508435372962, 2.04454796521753,
-    2.05410793165065, 2.06376754781173, 2.07353026351874, 2.0833996939983,
-    2.09337963113879, 2.10347405571488, 2.11368715068665, 2.12402331568952,
-    2.13448718284602, 2.14508363404789, 2.15581781987674, 2.16669518035431,
-    2.17772146774029, 2.18890277162636, 2.20024554661128, 2.21175664288416,
-    2.22344334009251, 2.23531338492992, 2.24737503294739, 2.25963709517379,
-    2.27210899022838, 2.28480080272449, 2.29772334890286, 2.31088825060137,
-    2.32430801887113, 2.33799614879653, 2.35196722737914, 2.36623705671729,
-    2.38082279517208, 2.39574311978193, 2.41101841390112, 2.42667098493715,
-    2.44272531820036, 2.4592083743347, 2.47614993967052, 2.49358304127105,
-    2.51154444162669, 2.53007523215985, 2.54922155032478, 2.56903545268184,
-    2.58957598670829, 2.61091051848882, 2.63311639363158, 2.65628303757674,
-    2.68051464328574, 2.70593365612306, 2.73268535904401, 2.76094400527999,
-    2.79092117400193, 2.82287739682644, 2.85713873087322, 2.89412105361341,
-    2.93436686720889, 2.97860327988184, 3.02783779176959, 3.08352613200214,
-    3.147889289518, 3.2245750520478, 3.32024473383983, 3.44927829856143,
-    3.65415288536101, 3.91075795952492 };
-
-  static real_T dv1[257] = { 1.0, 0.977101701267673, 0.959879091800108,
-    0.9451989534423, 0.932060075959231, 0.919991505039348, 0.908726440052131,
-    0.898095921898344, 0.887984660755834, 0.878309655808918, 0.869008688036857,
-    0.860033621196332, 0.851346258458678, 0.842915653112205, 0.834716292986884,
-    0.826726833946222, 0.818929191603703, 0.811307874312656, 0.803849483170964,
-    0.796542330422959, 0.789376143566025, 0.782341832654803, 0.775431304981187,
-    0.768637315798486, 0.761953346836795, 0.755373506507096, 0.748892447219157,
-    0.742505296340151, 0.736207598126863, 0.729995264561476, 0.72386453346863,
-    0.717811932630722, 0.711834248878248, 0.705928501332754, 0.700091918136512,
-    0.694321916126117, 0.688616083004672, 0.682972161644995, 0.677388036218774,
-    0.671861719897082, 0.66639134390875, 0.660975147776663, 0.655611470579697,
-    0.650298743110817, 0.645035480820822, 0.639820277453057, 0.634651799287624,
-    0.629528779924837, 0.624450015547027, 0.619414360605834, 0.614420723888914,
-    0.609468064925773, 0.604555390697468, 0.599681752619125, 0.594846243767987,
-    0.590047996332826, 0.585286179263371, 0.580559996100791, 0.575868682972354,
-    0.571211506735253, 0.566587763256165, 0.561996775814525, 0.557437893618766,
-    0.552910490425833, 0.548413963255266, 0.543947731190026, 0.539511234256952,
-    0.535103932380458, 0.530725304403662, 0.526374847171684, 0.522052074672322,
-    0.517756517229756, 0.513487720747327, 0.509245245995748, 0.505028667943468,
-    0.500837575126149, 0.49667156905249, 0.492530263643869, 0.488413284705458,
-    0.484320269426683, 0.480250865909047, 0.476204732719506, 0.47218153846773,
-    0.468180961405694, 0.464202689048174, 0.460246417812843, 0.456311852678716,
-    0.452398706861849, 0.448506701507203, 0.444635565395739, 0.440785034665804,
-    0.436954852547985, 0.433144769112652, 0.429354541029442, 0.425583931338022,
-    0.421832709229496, 0.418100649837848, 0.414387534040891, 0.410693148270188,
-    0.407017284329473, 0.403359739221114, 0.399720314980197, 0.396098818515832,
-    0.392495061459315, 0.388908860018789, 0.385340034840077, 0.381788410873393,
-    0.378253817245619, 0.374736087137891, 0.371235057668239, 0.367750569779032,
-    0.364282468129004, 0.360830600989648, 0.357394820145781, 0.353974980800077,
-    0.350570941481406, 0.347182563956794, 0.343809713146851, 0.340452257044522,
-    0.337110066637006, 0.333783015830718, 0.330470981379163, 0.327173842813601,
-    0.323891482376391, 0.320623784956905, 0.317370638029914, 0.314131931596337,
-    0.310907558126286, 0.307697412504292, 0.30450139197665, 0.301319396100803,
-    0.298151326696685, 0.294997087799962, 0.291856585617095, 0.288729728482183,
-    0.285616426815502, 0.282516593083708, 0.279430141761638, 0.276356989295668,
-    0.273297054068577, 0.270250256365875, 0.267216518343561, 0.264195763997261,
-    0.261187919132721, 0.258192911337619, 0.255210669954662, 0.252241126055942,
-    0.249284212418529, 0.246339863501264, 0.24340801542275, 0.240488605940501,
-    0.237581574431238, 0.23468686187233, 0.231804410824339, 0.228934165414681,
-    0.226076071322381, 0.223230075763918, 0.220396127480152, 0.217574176724331,
-    0.214764175251174, 0.211966076307031, 0.209179834621125, 0.206405406397881,
-    0.203642749310335, 0.200891822494657, 0.198152586545776, 0.195425003514135,
-    0.192709036903589, 0.190004651670465, 0.187311814223801, 0.1846304924268,
-    0.181960655599523, 0.179302274522848, 0.176655321443735, 0.174019770081839,
-    0.171395595637506, 0.168782774801212, 0.166181285764482, 0.163591108232366,
-    0.161012223437511, 0.158444614155925, 0.15588826472448, 0.153343161060263,
-    0.150809290681846, 0.148286642732575, 0.145775208005994, 0.143274978973514,
-    0.140785949814445, 0.138308116448551, 0.135841476571254, 0.133386029691669,
-    0.130941777173644, 0.12850872228, 0.126086870220186, 0.123676228201597,
-    0.12127680548479, 0.11888861344291, 0.116511665625611, 0.114145977827839,
-    0.111791568163838, 0.109448457146812, 0.107116667774684, 0.104796225622487,
-    0.102487158941935, 0.10018949876881, 0.0979032790388625, 0.095628536713009,
-    0.093365311912691, 0.0911136480663738, 0.0888735920682759,
-    0.0866451944505581, 0.0844285095703535, 0.082223595813203,
-    0.0800305158146631, 0.0778493367020961, 0.0756801303589272,
-    0.0735229737139814, 0.0713779490588905, 0.0692451443970068,
-    0.0671246538277886, 0.065016577971243, 0.0629210244377582, 0.06083810834954,
-    0.0587679529209339, 0.0567106901062031, 0.0546664613248891,
-    0.0526354182767924, 0.0506177238609479, 0.0486135532158687,
-    0.0466230949019305, 0.0446465522512946, 0.0426841449164746,
-    0.0407361106559411, 0.0388027074045262, 0.0368842156885674,
-    0.0349809414617162, 0.0330932194585786, 0.0312214171919203,
-    0.0293659397581334, 0.0275272356696031, 0.0257058040085489,
-    0.0239022033057959, 0.0221170627073089, 0.0203510962300445,
-    0.0186051212757247, 0.0168800831525432, 0.0151770883079353,
-    0.0134974506017399, 0.0118427578579079, 0.0102149714397015,
-    0.00861658276939875, 0.00705087547137324, 0.00552240329925101,
-    0.00403797259336304, 0.00260907274610216, 0.0012602859304986,
-    0.000477467764609386 };
-
-  emlrtStack st;
-  real_T u[2];
-  real_T x;
-  real_T z;
-  int32_T exitg1;
-  uint32_T ik;
-  st.prev = sp;
-  st.tls = sp->tls;
-  do {
-    exitg1 = 0;
-    st.site = &cc_emlrtRSI;
-    RandStream_rand(&st, s, u);
-    ik = (uint32_T)(256.0 * u[0]) + 1U;
-    z = (2.0 * u[1] - 1.0) * dv[(int32_T)ik];
-    if (muDoubleScalarAbs(z) <= dv[(int32_T)ik - 1]) {
-      exitg1 = 1;
-    } else if (ik < 256U) {
-      st.site = &dc_emlrtRSI;
-      u[0] = b_RandStream_rand(&st, s);
-      if (dv1[(int32_T)ik] + u[0] * (dv1[(int32_T)ik - 1] - dv1[(int32_T)ik]) <
-          muDoubleScalarExp(-0.5 * z * z)) {
-        exitg1 = 1;
-      }
-    } else {
-      do {
-        st.site = &ec_emlrtRSI;
-        RandStream_rand(&st, s, u);
-        x = muDoubleScalarLog(u[0]) * 0.273661237329758;
-      } while (!(x * x < -2.0 * muDoubleScalarLog(u[1])));
-
-      if (z < 0.0) {
-        z = x - 3.65415288536101;
-      } else {
-        z = 3.65415288536101 - x;
-      }
-
-      exitg1 = 1;
-    }
-  } while (exitg1 == 0);
-
-  return z;
-}
-
 static void RandStream_rand(const emlrtStack *sp, coder_internal_RandStream *s,
   real_T u[2])
 {
@@ -2803,6 +3134,276 @@ static real_T RandStream_inversionGenrandn(const emlrtStack *sp,
   return z;
 }
 
+static void RandStream_zigguratGenrandnBlock(const emlrtStack *sp,
+  coder_internal_RandStream *s, real_T r[], int32_T n)
+{
+  emlrtStack st;
+  st.prev = sp;
+  st.tls = sp->tls;
+  st.site = &pb_emlrtRSI;
+  mt19937ar_mtziggurat_block(&st, s->Generator, r, n);
+}
+
+static void RandStream_polarGenrandnBlock(const emlrtStack *sp,
+  coder_internal_RandStream *s, real_T r[], int32_T n)
+{
+  emlrtStack st;
+  int32_T k;
+  st.prev = sp;
+  st.tls = sp->tls;
+  st.site = &hc_emlrtRSI;
+  for (k = 0; k < n; k++) {
+    r[k] = RandStream_polarGenrandn(&st, s);
+  }
+}
+
+static void RandStream_inversionGenrandnBlock(const emlrtStack *sp,
+  coder_internal_RandStream *s, real_T r[], int32_T n)
+{
+  emlrtStack st;
+  int32_T k;
+  st.prev = sp;
+  st.tls = sp->tls;
+  st.site = &kc_emlrtRSI;
+  for (k = 0; k < n; k++) {
+    r[k] = RandStream_inversionGenrandn(&st, s);
+  }
+}
+
+static uint32_T *AWGNChannel_legacyTwisterState(const emlrtStack *sp,
+  InstanceStruct_6ZqTk0OKN5QuhEtSrZC29B *moduleInstance)
+{
+  static const int32_T iv[2] = { 1, 12 };
+
+  static char_T b_u[12] = { 'M', 'A', 'T', 'L', 'A', 'B', ':', 'n', 'o', 'm',
+    'e', 'm' };
+
+  const mxArray *b_y;
+  const mxArray *m;
+  const mxArray *y;
+
+  /* The legacy twister state is 2.5 KB, so it is allocated the first time */
+  /* the twister method is seeded rather than with every instance. Returns */
+  /* NULL after raising MATLAB:nomem if it cannot be allocated. */
+  if (moduleInstance->state == NULL) {
+    moduleInstance->state = (uint32_T *)malloc(625U * sizeof(uint32_T));
+    if (moduleInstance->state == NULL) {
+      y = NULL;
+      m = emlrtCreateCharArray(2, &iv[0]);
+      emlrtInitCharArrayR2013a((emlrtConstCTX)sp, 12, m, &b_u[0]);
+      emlrtAssign(&y, m);
+      b_y = NULL;
+      m = emlrtCreateCharArray(2, &iv[0]);
+      emlrtInitCharArrayR2013a((emlrtConstCTX)sp, 12, m, &b_u[0]);
+      emlrtAssign(&b_y, m);
+      error(sp, y, getString(sp, b_message(sp, b_y, &d_emlrtMCI), &d_emlrtMCI),
+            &d_emlrtMCI);
+      return NULL;
+    }
+
+    memcpy(moduleInstance->state, &mt19937ar_state5489[0], 625U * sizeof
+           (uint32_T));
+    moduleInstance->state_not_empty = true;
+  }
+
+  return moduleInstance->state;
+}
+
+static void AWGNChannel_setupRandomStream(const emlrtStack *sp,
+  InstanceStruct_6ZqTk0OKN5QuhEtSrZC29B *moduleInstance,
+  comm_internal_AWGNChannel *obj)
+{
+  static const int32_T iv[2] = { 1, 34 };
+
+  static const int32_T iv1[2] = { 1, 72 };
+
+  static char_T b_u[34] = { 'c', 'o', 'm', 'm', ':', 'A', 'W', 'G', 'N', 'C',
+    'h', 'a', 'n', 'n', 'e', 'l', ':', 'I', 'n', 'v', 'a', 'l', 'i', 'd', 'I',
+    'n', 's', 't', 'a', 'n', 'c', 'e', 'I', 'D' };
+
+  static char_T c_u[72] = { 'I', 'n', 's', 't', 'a', 'n', 'c', 'e', 'I', 'D',
+    ' ', 'm', 'u', 's', 't', ' ', 'b', 'e', ' ', 'a', 'n', ' ', 'i', 'n', 't',
+    'e', 'g', 'e', 'r', ' ', 'i', 'n', ' ', '[', '0', ',', ' ', '2', '^', '3',
+    '0', ')', ',', ' ', 'a', 'n', 'd', ' ', 'i', 's', ' ', 'r', 'e', 'q', 'u',
+    'i', 'r', 'e', 'd', ' ', 'w', 'i', 't', 'h', ' ', 'p', 'h', 'i', 'l', 'o',
+    'x', '.' };
+
+  const mxArray *b_y;
+  const mxArray *m;
+  const mxArray *y;
+  real_T x;
+  int_T nParams;
+
+  /* Optional run-time parameters after EbNo and SignalPower select the */
+  /* noise generator: */
+  /*   3 - Generator,  0 = mt19937ar (default), 1 = philox4x32-10 */
+  /*   4 - Seed,       integer in [0, 2^53), replaces the wall-clock seed */
+  /*   5 - InstanceID, integer in [0, 2^30), required with philox */
+  /* With philox every sample is a pure function of (Seed, InstanceID, */
+  /* step index, channel, sample index), so instances can be stepped on */
+  /* separate threads or processes and still be replayed exactly. The */
+  /* InstanceID is the upper 30 bits of the third counter word, so it */
+  /* must be given by the model rather than taken from the start order, */
+  /* and it must fit in 30 bits or two instances would share a stream. */
+  nParams = ssGetNumRunTimeParams(moduleInstance->S);
+  obj->pGenerator = comm_internal_AWGNGenerator_mt19937ar;
+  if (nParams > 2) {
+    x = *(real_T *)cgxertGetRunTimeParamInfoData(moduleInstance->S, 2);
+    if (x == 1.0) {
+      obj->pGenerator = comm_internal_AWGNGenerator_philox;
+    } else if (x != 0.0) {
+      emlrtErrorWithMessageIdR2018a(sp, &emlrtRTEI,
+        "comm:AWGNChannel:InvalidGenerator",
+        "comm:AWGNChannel:InvalidGenerator", 0);
+    }
+  }
+
+  obj->pHasSeed = (nParams > 3);
+  obj->pSeed[0] = 0U;
+  obj->pSeed[1] = 0U;
+  obj->pSeedStateValid = false;
+  if (obj->pHasSeed) {
+    x = *(real_T *)cgxertGetRunTimeParamInfoData(moduleInstance->S, 3);
+    if ((x >= 0.0) && (x < 9.007199254740992E+15) && (x ==
+         muDoubleScalarFloor(x))) {
+      obj->pSeed[1] = (uint32_T)muDoubleScalarFloor(x / 4.294967296E+9);
+      obj->pSeed[0] = (uint32_T)(x - (real_T)obj->pSeed[1] * 4.294967296E+9);
+    } else {
+      emlrtErrorWithMessageIdR2018a(sp, &emlrtRTEI,
+        "comm:AWGNChannel:InvalidSeed", "comm:AWGNChannel:InvalidSeed", 0);
+    }
+  }
+
+  obj->pInstanceID = 0U;
+  x = -1.0;
+  if (nParams > 4) {
+    x = *(real_T *)cgxertGetRunTimeParamInfoData(moduleInstance->S, 4);
+  }
+
+  if ((x >= 0.0) && (x < 1.073741824E+9) && (x == muDoubleScalarFloor(x))) {
+    obj->pInstanceID = (uint32_T)x;
+  } else if ((nParams > 4) || (obj->pGenerator ==
+              comm_internal_AWGNGenerator_philox)) {
+    y = NULL;
+    m = emlrtCreateCharArray(2, &iv[0]);
+    emlrtInitCharArrayR2013a((emlrtConstCTX)sp, 34, m, &b_u[0]);
+    emlrtAssign(&y, m);
+    b_y = NULL;
+    m = emlrtCreateCharArray(2, &iv1[0]);
+    emlrtInitCharArrayR2013a((emlrtConstCTX)sp, 72, m, &c_u[0]);
+    emlrtAssign(&b_y, m);
+    error(sp, y, b_y, &d_emlrtMCI);
+  }
+
+  obj->pStream.PhiloxKey[0] = obj->pSeed[0];
+  obj->pStream.PhiloxKey[1] = obj->pSeed[1];
+  obj->pStream.PhiloxCounter[0] = 0U;
+  obj->pStream.PhiloxCounter[1] = 0U;
+  obj->pStream.PhiloxCounter[2] = 0U;
+  obj->pStream.PhiloxCounter[3] = 0U;
+  obj->pStepIndex[0] = 0U;
+  obj->pStepIndex[1] = 0U;
+}
+
+static void mul_wide_u32(uint32_T in0, uint32_T in1, uint32_T *ptrOutBitsHi,
+  uint32_T *ptrOutBitsLo)
+{
+  uint32_T in0Hi;
+  uint32_T in0Lo;
+  uint32_T in1Hi;
+  uint32_T in1Lo;
+  uint32_T outBitsLo;
+  uint32_T productHiLo;
+  uint32_T productLoHi;
+  in0Hi = in0 >> 16U;
+  in0Lo = in0 & 65535U;
+  in1Hi = in1 >> 16U;
+  in1Lo = in1 & 65535U;
+  productHiLo = in0Hi * in1Lo;
+  productLoHi = in0Lo * in1Hi;
+  in0Lo *= in1Lo;
+  in1Lo = 0U;
+  outBitsLo = in0Lo + (productLoHi << 16U);
+  if (outBitsLo < in0Lo) {
+    in1Lo = 1U;
+  }
+
+  in0Lo = outBitsLo;
+  outBitsLo += productHiLo << 16U;
+  if (outBitsLo < in0Lo) {
+    in1Lo++;
+  }
+
+  *ptrOutBitsHi = ((in1Lo + in0Hi * in1Hi) + (productLoHi >> 16U)) +
+    (productHiLo >> 16U);
+  *ptrOutBitsLo = outBitsLo;
+}
+
+static void philox4x32_10(const uint32_T ctr[4], const uint32_T key[2],
+  uint32_T out[4])
+{
+  int32_T r;
+  uint32_T hi0;
+  uint32_T hi1;
+  uint32_T k0;
+  uint32_T k1;
+  uint32_T lo0;
+  uint32_T lo1;
+
+  /* Philox4x32-10 (Salmon et al., SC'11): ten rounds of two 32x32->64 */
+  /* multiplies with a Weyl-sequence key schedule. */
+  out[0] = ctr[0];
+  out[1] = ctr[1];
+  out[2] = ctr[2];
+  out[3] = ctr[3];
+  k0 = key[0];
+  k1 = key[1];
+  for (r = 0; r < 10; r++) {
+    mul_wide_u32(3528531795U, out[0], &hi0, &lo0);
+    mul_wide_u32(3449720151U, out[2], &hi1, &lo1);
+    out[0] = hi1 ^ out[1] ^ k0;
+    out[1] = lo1;
+    out[2] = hi0 ^ out[3] ^ k1;
+    out[3] = lo0;
+    k0 += 2654435769U;
+    k1 += 3144134277U;
+  }
+}
+
+static void RandStream_philoxGenrandnBlock(const emlrtStack *sp,
+  coder_internal_RandStream *s, real_T r[], int32_T n)
+{
+  real_T rho;
+  real_T theta;
+  int32_T j;
+  int32_T k;
+  uint32_T w[4];
+  (void)sp;
+
+  /* Each counter value yields four uniforms and, through Box-Muller, four */
+  /* deviates. The low counter word is the block index within the column; */
+  /* the caller sets the other three words. */
+  k = 0;
+  while (k < n) {
+    philox4x32_10(s->PhiloxCounter, s->PhiloxKey, w);
+    s->PhiloxCounter[3]++;
+    for (j = 0; j < 4; j += 2) {
+      rho = muDoubleScalarSqrt(-2.0 * muDoubleScalarLog((real_T)w[j] *
+        2.3283064365386963E-10 + 1.1641532182693481E-10));
+      theta = 6.2831853071795862 * ((real_T)w[j + 1] * 2.3283064365386963E-10);
+      if (k < n) {
+        r[k] = rho * muDoubleScalarCos(theta);
+        k++;
+      }
+
+      if (k < n) {
+        r[k] = rho * muDoubleScalarSin(theta);
+        k++;
+      }
+    }
+  }
+}
+
 static const mxArray *message(const emlrtStack *sp, const mxArray *m1, const
   mxArray *m2, emlrtMCInfo *location)
 {
@@ -2847,12 +3448,29 @@ static const mxArray *b_message(const emlrtStack *sp, const mxArray *m1,
 static void init_simulink_io_address(InstanceStruct_6ZqTk0OKN5QuhEtSrZC29B
   *moduleInstance)
 {
-  moduleInstance->emlrtRootTLSGlobal = (void *)cgxertGetEMLRTCtx
+  moduleInstance->hot.emlrtRootTLSGlobal = (void *)cgxertGetEMLRTCtx
     (moduleInstance->S);
-  moduleInstance->u0 = (creal_T (*)[3])cgxertGetInputPortSignal
-    (moduleInstance->S, 0);
-  moduleInstance->b_y0 = (creal_T (*)[3])cgxertGetOutputPortSignal
-    (moduleInstance->S, 0);
+  moduleInstance->hot.u0 = (creal_T *)cgxertGetInputPortSignal(moduleInstance->S,
+    0);
+  moduleInstance->hot.b_y0 = (creal_T *)cgxertGetOutputPortSignal(moduleInstance->S,
+    0);
+
+  /* Frame mode: the port carries frameLength samples for each of the 3 */
+  /* channels, stored column-major. A 1-by-3 port is a one-sample frame; */
+  /* start rejects a width that is not a positive multiple of 3. */
+  moduleInstance->hot.frameLength = (int32_T)(ssGetInputPortWidth(moduleInstance->S,
+    0) / 3);
+  if (moduleInstance->hot.frameLength < 1) {
+    moduleInstance->hot.frameLength = 1;
+  }
+
+  /* Optional second input: precomputed noise standard deviation, 1-by-3. */
+  if (ssGetNumInputPorts(moduleInstance->S) > 1) {
+    moduleInstance->hot.stdIn = (real_T *)cgxertGetInputPortSignal
+      (moduleInstance->S, 1);
+  } else {
+    moduleInstance->hot.stdIn = NULL;
+  }
 }
 
 /* CGXE Glue Code */
@@ -2889,7 +3507,8 @@ static void mdlTerminate_6ZqTk0OKN5QuhEtSrZC29B(SimStruct *S)
   InstanceStruct_6ZqTk0OKN5QuhEtSrZC29B *moduleInstance =
     (InstanceStruct_6ZqTk0OKN5QuhEtSrZC29B *)cgxertGetRuntimeInstance(S);
   cgxe_mdl_terminate(moduleInstance);
-  free((void *)moduleInstance);
+  free((void *)moduleInstance->state);
+  free(moduleInstance->allocBase);
 }
 
 static void mdlEnable_6ZqTk0OKN5QuhEtSrZC29B(SimStruct *S)
@@ -2908,9 +3527,15 @@ static void mdlDisable_6ZqTk0OKN5QuhEtSrZC29B(SimStruct *S)
 
 static void mdlStart_6ZqTk0OKN5QuhEtSrZC29B(SimStruct *S)
 {
-  InstanceStruct_6ZqTk0OKN5QuhEtSrZC29B *moduleInstance =
-    (InstanceStruct_6ZqTk0OKN5QuhEtSrZC29B *)calloc(1, sizeof
-    (InstanceStruct_6ZqTk0OKN5QuhEtSrZC29B));
+  InstanceStruct_6ZqTk0OKN5QuhEtSrZC29B *moduleInstance;
+  void *allocBase;
+
+  /* Align the instance to a cache line so that moduleInstance->hot does */
+  /* not straddle two lines. */
+  allocBase = calloc(1, sizeof(InstanceStruct_6ZqTk0OKN5QuhEtSrZC29B) + 63U);
+  moduleInstance = (InstanceStruct_6ZqTk0OKN5QuhEtSrZC29B *)((char_T *)
+    allocBase + ((64U - ((size_t)allocBase & 63U)) & 63U));
+  moduleInstance->allocBase = allocBase;
   moduleInstance->S = S;
   cgxertSetRuntimeInstance(S, (void *)moduleInstance);
   ssSetmdlOutputs(S, mdlOutputs_6ZqTk0OKN5QuhEtSrZC29B);
@@ -2956,6 +3581,107 @@ void method_dispatcher_6ZqTk0OKN5QuhEtSrZC29B(SimStruct *S, int_T method, void
   }
 }
 
+void outputs_batch_6ZqTk0OKN5QuhEtSrZC29B(SimStruct *S[], int_T n)
+{
+  emlrtStack st = { NULL,              /* site */
+    NULL,                              /* tls */
+    NULL                               /* prev */
+  };
+
+  InstanceStruct_6ZqTk0OKN5QuhEtSrZC29B *inst[64];
+  real_T (*b_EbNo[64])[3];
+  real_T b_SignalPower[64];
+  int_T i;
+  int_T i0;
+  int_T m;
+  boolean_T steady[64];
+
+  /* Steps n instances of this module in one call. Each chunk of up to 64 */
+  /* instances is first gathered into local arrays (instance, parameters, */
+  /* steady-state flag), then stepped. Steady instances add their noise */
+  /* directly; the rest take the per-instance output path, so the result */
+  /* matches calling mdlOutputs on each block in order. */
+  for (i0 = 0; i0 < n; i0 += 64) {
+    m = n - i0;
+    if (m > 64) {
+      m = 64;
+    }
+
+    for (i = 0; i < m; i++) {
+      inst[i] = (InstanceStruct_6ZqTk0OKN5QuhEtSrZC29B *)
+        cgxertGetRuntimeInstance(S[i0 + i]);
+      b_EbNo[i] = (real_T (*)[3])cgxertGetRunTimeParamInfoData(S[i0 + i], 0);
+      b_SignalPower[i] = *(real_T *)cgxertGetRunTimeParamInfoData(S[i0 + i], 1);
+      steady[i] = AWGNChannel_isSteadyState(inst[i], *b_EbNo[i],
+        b_SignalPower[i]);
+    }
+
+    for (i = 0; i < m; i++) {
+      if (steady[i]) {
+        st.tls = inst[i]->hot.emlrtRootTLSGlobal;
+        AWGNChannel_addNoise(&st, &inst[i]->sysobj, inst[i]->hot.stdIn != NULL ?
+                             inst[i]->hot.stdIn : inst[i]->hot.std,
+                             inst[i]->hot.u0, inst[i]->hot.b_y0,
+                             inst[i]->hot.frameLength);
+      } else {
+        cgxe_mdl_outputs(inst[i]);
+      }
+    }
+  }
+}
+
+void fused_outputs_6ZqTk0OKN5QuhEtSrZC29B(SimStruct *S, const creal_T x[], const
+  int32_T linkIds[6])
+{
+  emlrtStack st = { NULL,              /* site */
+    NULL,                              /* tls */
+    NULL                               /* prev */
+  };
+
+  InstanceStruct_6ZqTk0OKN5QuhEtSrZC29B *moduleInstance;
+  real_T (*b_EbNo)[3];
+  real_T *b_SignalPower;
+  int32_T frameLength;
+  int32_T rx;
+  int32_T tx;
+
+  /* Fused NetworkChannel fading and AWGN for one block. x holds the three */
+  /* transmitted columns and linkIds the NetworkChannel link handles; the */
+  /* noisy received columns are written to the block output. The steady */
+  /* state runs the fused kernel. Otherwise the faded signal is written */
+  /* to the block input and the normal step runs, so this entry is for */
+  /* hosts that own the block's port buffers. */
+  moduleInstance = (InstanceStruct_6ZqTk0OKN5QuhEtSrZC29B *)
+    cgxertGetRuntimeInstance(S);
+  b_EbNo = (real_T (*)[3])cgxertGetRunTimeParamInfoData(S, 0);
+  b_SignalPower = (real_T *)cgxertGetRunTimeParamInfoData(S, 1);
+  frameLength = moduleInstance->hot.frameLength;
+  if (AWGNChannel_isSteadyState(moduleInstance, *b_EbNo, *b_SignalPower)) {
+    st.tls = moduleInstance->hot.emlrtRootTLSGlobal;
+    AWGNChannel_addFadedNoise(&st, &moduleInstance->sysobj,
+      moduleInstance->hot.stdIn != NULL ? moduleInstance->hot.stdIn :
+      moduleInstance->hot.std, x, linkIds, moduleInstance->hot.b_y0, frameLength);
+  } else {
+    memset(moduleInstance->hot.u0, 0, (size_t)(3 * frameLength) * sizeof
+           (creal_T));
+    for (rx = 0; rx < 3; rx++) {
+      for (tx = 0; tx < 3; tx++) {
+        if (tx < rx) {
+          networkFadingStep(linkIds[tx + 3 * (rx - 1)], &x[tx * frameLength],
+                            &moduleInstance->hot.u0[rx * frameLength],
+                            frameLength, true);
+        } else if (tx > rx) {
+          networkFadingStep(linkIds[tx + 3 * rx], &x[tx * frameLength],
+                            &moduleInstance->hot.u0[rx * frameLength],
+                            frameLength, true);
+        }
+      }
+    }
+
+    cgxe_mdl_outputs(moduleInstance);
+  }
+}
+
 mxArray *cgxe_6ZqTk0OKN5QuhEtSrZC29B_BuildInfoUpdate(void)
 {
   mxArray * mxBIArgs;
@@ -2975,7 +3701,6 @@ mxArray *cgxe_6ZqTk0OKN5QuhEtSrZC29B_BuildInfoUpdate(void)
   mxArray * elem_14;
   mxArray * elem_15;
   mxArray * elem_16;
-  double * pointer;
   mxBIArgs = mxCreateCellMatrix(1,3);
   elem_1 = mxCreateCellMatrix(1,6);
   elem_2 = mxCreateCellMatrix(0,0);
@@ -3006,7 +3731,6 @@ mxArray *cgxe_6ZqTk0OKN5QuhEtSrZC29B_BuildInfoUpdate(void)
   mxSetCell(elem_1,5,elem_14);
   mxSetCell(mxBIArgs,0,elem_1);
   elem_15 = mxCreateDoubleMatrix(0,0, mxREAL);
-  pointer = mxGetPr(elem_15);
   mxSetCell(mxBIArgs,1,elem_15);
   elem_16 = mxCreateCellMatrix(1,0);
   mxSetCell(mxBIArgs,2,elem_16);
@@ -12,6 +12,22 @@
 /* Type Definitions */
 #include <time.h>
 #include <time.h>
+#ifdef AWGN_TSC_PROFILE
+
+/* Phases timed by the instrumentation build (-DAWGN_TSC_PROFILE) */
+#define AWGN_TSC_SETUP                 0
+#define AWGN_TSC_TUNABLE               1
+#define AWGN_TSC_RNG                   2
+#define AWGN_TSC_NOISE                 3
+#define AWGN_TSC_STEP                  4
+#define AWGN_TSC_NUM_PHASES            5
+
+typedef struct {
+  uint64_T cycles[AWGN_TSC_NUM_PHASES];
+  uint64_T calls[AWGN_TSC_NUM_PHASES];
+} awgnTscCounters;
+
+#endif
 #ifndef struct_tag_s3IEoOEzmWfHdqYldDQhLvB
 #define struct_tag_s3IEoOEzmWfHdqYldDQhLvB
 
@@ -760,6 +776,8 @@ struct tag_xA3DogVhhJHOspRusE5FCF
   boolean_T HaveSavedPolarValue;
   coder_internal_mt19937ar *Generator;
   coder_internal_mt19937ar MtGenerator;
+  uint32_T PhiloxKey[2];
+  uint32_T PhiloxCounter[4];
 };
 
 #endif                                 /* struct_tag_xA3DogVhhJHOspRusE5FCF */
@@ -771,6 +789,29 @@ typedef struct tag_xA3DogVhhJHOspRusE5FCF coder_internal_RandStream;
 
 #endif                                 /* typedef_coder_internal_RandStream */
 
+#ifndef typedef_comm_internal_AWGNGenerator
+#define typedef_comm_internal_AWGNGenerator
+
+typedef int32_T comm_internal_AWGNGenerator;
+
+#endif                                 /* typedef_comm_internal_AWGNGenerator */
+
+#ifndef comm_internal_AWGNGenerator_constants
+#define comm_internal_AWGNGenerator_constants
+
+/* enum comm_internal_AWGNGenerator */
+#define comm_internal_AWGNGenerator_mt19937ar (0)
+#define comm_internal_AWGNGenerator_philox (1)
+#endif                                 /* comm_internal_AWGNGenerator_constants */
+
+#ifndef typedef_coder_internal_RandnBlockFcn
+#define typedef_coder_internal_RandnBlockFcn
+
+typedef void (*coder_internal_RandnBlockFcn)(const struct emlrtStack *sp,
+  coder_internal_RandStream *s, real_T r[], int32_T n);
+
+#endif                                 /* typedef_coder_internal_RandnBlockFcn */
+
 #ifndef struct_tag_PSXs2vqQ2Xdi9S5AMeauj
 #define struct_tag_PSXs2vqQ2Xdi9S5AMeauj
 
@@ -778,14 +819,38 @@ struct tag_PSXs2vqQ2Xdi9S5AMeauj
 {
   int32_T isInitialized;
   boolean_T TunablePropsChanged;
-  cell_wrap inputVarSize[1];
+  boolean_T pIsVarChannel;
+  comm_internal_AWGNGenerator pGenerator;
+  coder_internal_RandnBlockFcn pRandnFcn;
   real_T EbNo[3];
   real_T SignalPower;
   real_T pFirstInputNumChan;
-  boolean_T pIsVarChannel;
   real_T pNumChanFromProp;
   real_T pStd[3];
+  uint32_T pStepIndex[2];
+  uint32_T pInstanceID;
+  uint32_T pSeed[2];
+  boolean_T pHasSeed;
+  cell_wrap inputVarSize[1];
   coder_internal_RandStream pStream;
+  real_T pStdCacheSignalPower;
+  real_T pStdCacheEbNo[16];
+  real_T pStdCacheValue[16];
+  boolean_T pStdCacheValid[16];
+
+  /* Twister state right after seeding with pSeedStateKey, copied on reset */
+  /* instead of running the initialization again */
+  uint32_T pSeedState[625];
+  uint32_T pSeedStateKey[2];
+  boolean_T pSeedStateValid;
+
+#ifdef AWGN_TSC_PROFILE
+
+  /* Counters of the owning instance, set at start */
+  awgnTscCounters *pTsc;
+
+#endif
+
 };
 
 #endif                                 /* struct_tag_PSXs2vqQ2Xdi9S5AMeauj */
@@ -797,26 +862,53 @@ typedef struct tag_PSXs2vqQ2Xdi9S5AMeauj comm_internal_AWGNChannel;
 
 #endif                                 /* typedef_comm_internal_AWGNChannel */
 
+#ifndef typedef_InstanceHot_6ZqTk0OKN5QuhEtSrZC29B
+#define typedef_InstanceHot_6ZqTk0OKN5QuhEtSrZC29B
+
+/* Fields read on every step. Kept first in the instance, which mdlStart */
+/* aligns to 64 bytes, so that they share a single cache line. */
+typedef struct {
+  real_T std[3];
+  creal_T *u0;
+  creal_T *b_y0;
+  real_T *stdIn;
+  void *emlrtRootTLSGlobal;
+  int32_T frameLength;
+  comm_internal_AWGNGenerator generator;
+} InstanceHot_6ZqTk0OKN5QuhEtSrZC29B;
+
+#endif                                 /* typedef_InstanceHot_6ZqTk0OKN5QuhEtSrZC29B */
+
 #ifndef typedef_InstanceStruct_6ZqTk0OKN5QuhEtSrZC29B
 #define typedef_InstanceStruct_6ZqTk0OKN5QuhEtSrZC29B
 
 typedef struct {
+  InstanceHot_6ZqTk0OKN5QuhEtSrZC29B hot;
   SimStruct *S;
-  comm_internal_AWGNChannel sysobj;
+  void *allocBase;
   boolean_T sysobj_not_empty;
+  comm_internal_AWGNChannel sysobj;
+
+  /* Legacy rand generator states, only touched by setup. The 625-word */
+  /* twister state is allocated when setup seeds the twister method (7). */
+  uint32_T *state;
   uint32_T seed;
-  boolean_T seed_not_empty;
   uint32_T method;
+  uint32_T b_state[2];
+  uint32_T c_state;
+  boolean_T seed_not_empty;
   boolean_T method_not_empty;
-  uint32_T state[625];
   boolean_T state_not_empty;
-  uint32_T b_state[2];
   boolean_T b_state_not_empty;
-  uint32_T c_state;
   boolean_T c_state_not_empty;
-  void *emlrtRootTLSGlobal;
-  creal_T (*u0)[3];
-  creal_T (*b_y0)[3];
+
+#ifdef AWGN_TSC_PROFILE
+
+  /* Cycles and calls per phase, printed at terminate */
+  awgnTscCounters tsc;
+
+#endif
+
 } InstanceStruct_6ZqTk0OKN5QuhEtSrZC29B;
 
 #endif                                 /* typedef_InstanceStruct_6ZqTk0OKN5QuhEtSrZC29B */
@@ -832,5 +924,8 @@ typedef struct {
 /* Function Definitions */
 extern void method_dispatcher_6ZqTk0OKN5QuhEtSrZC29B(SimStruct *S, int_T method,
   void* data);
+extern void outputs_batch_6ZqTk0OKN5QuhEtSrZC29B(SimStruct *S[], int_T n);
+extern void fused_outputs_6ZqTk0OKN5QuhEtSrZC29B(SimStruct *S, const creal_T x[],
+  const int32_T linkIds[6]);
 
 #endif
@@ -0,0 +1,186 @@
+function [hit, key] = slprjCache(action, modelName, options)
+%slprjCache Shared content-addressed cache of the model's generated code
+%   [HIT, KEY] = slprjCache("fetch", MODELNAME) looks up the code
+%   generation artifacts of MODELNAME for the current model sources in the
+%   shared cache and, on a hit, copies them into the checkout: the
+%   compiled S-function MEX, slprj/_cprj, slprj/_cgxe, slprj/_jitprj,
+%   slprj/accel and the Simulink cache file. The next model update then
+%   finds up-to-date code and skips code generation and compilation. HIT is
+%   false if the cache holds nothing for these sources, and the checkout is
+%   then left unchanged.
+%
+%   [HIT, KEY] = slprjCache("store", MODELNAME) adds the artifacts of the
+%   last build to the cache. Call it after a model update or simulation.
+%
+%   Artifacts are stored once per KEY, the hexadecimal overall checksum
+%   returned by the S-function's get_checksums command, which combines the
+%   modules, model, makefile and target checksums. An index maps the hash
+%   of the model sources (the .slx, .m, .c and .h files of the folder,
+%   except this file) and the MATLAB release to KEY, so that a checkout
+%   which has not built yet can find the artifacts. Each object also keeps
+%   the list of the source checksums it was built from. A fetch copies the
+%   object into a staging folder and copies it into the checkout only if
+%   that list matches the checksums of the checkout's own sources and the
+%   checksums of the staged MEX match KEY.
+%
+%   slprjCache(..., Folder=F) uses the checkout folder F, e.g. the same
+%   example in another copy of the tree. The default is the folder of this
+%   file. slprjCache(..., CacheRoot=R) sets the cache folder. The default
+%   is the SLPRJ_CACHE_ROOT environment variable, or slprj_cache in
+%   tempdir if it is not set. Several checkouts and workers can share the
+%   cache folder: objects are written to a temporary folder and renamed
+%   into place.
+
+arguments
+    action (1,1) string {mustBeMember(action, ["fetch" "store"])}
+    modelName (1,1) string = "PacketizedNetworkSimulinkExample"
+    options.Folder (1,1) string = fileparts(mfilename('fullpath'))
+    options.CacheRoot (1,1) string = defaultCacheRoot()
+end
+
+folder = options.Folder;
+objectsDir = fullfile(options.CacheRoot, "objects");
+indexDir = fullfile(options.CacheRoot, "index");
+[sourcesHash, sourcesList] = hashSources(folder);
+indexFile = fullfile(indexDir, sourcesHash + ".txt");
+mexName = modelName + "_cgxe";
+
+if action == "fetch"
+    hit = false;
+    key = "";
+    if ~isfile(indexFile)
+        return;
+    end
+    key = strtrim(string(fileread(indexFile)));
+    objectDir = fullfile(objectsDir, key);
+    if ~isfolder(objectDir)
+        return;
+    end
+    % Verify a staged copy, so that a stale or partial object never
+    % replaces the checkout's artifacts
+    stageDir = string(tempname);
+    mkdir(stageDir);
+    removeStage = onCleanup(@() rmdir(stageDir, 's'));
+    copyArtifacts(objectDir, stageDir, modelName);
+    sourcesFile = fullfile(objectDir, "sources.txt");
+    if ~isfile(sourcesFile) || string(fileread(sourcesFile)) ~= sourcesList ...
+            || checksumKey(stageDir, mexName) ~= key
+        return;
+    end
+    unloadMex(mexName);
+    copyArtifacts(stageDir, folder, modelName);
+    hit = true;
+    return;
+end
+
+% store
+key = checksumKey(folder, mexName);
+if key == ""
+    error('slprjCache:NoBuild', 'No %s.%s in %s. Build the model first.', ...
+        mexName, mexext, folder);
+end
+objectDir = fullfile(objectsDir, key);
+if ~isfolder(objectDir)
+    tmpDir = objectDir + ".tmp" + string(feature('getpid'));
+    copyArtifacts(folder, tmpDir, modelName);
+    fileID = fopen(fullfile(tmpDir, "sources.txt"), 'w');
+    fprintf(fileID, '%s', sourcesList);
+    fclose(fileID);
+    [ok, ~, msgID] = movefile(tmpDir, objectDir);
+    if ~ok
+        % Another worker stored the same key first
+        rmdir(tmpDir, 's');
+        if ~isfolder(objectDir)
+            error('slprjCache:StoreFailed', 'Cannot store %s (%s).', ...
+                objectDir, msgID);
+        end
+    end
+end
+if ~isfolder(indexDir)
+    mkdir(indexDir);
+end
+fileID = fopen(indexFile, 'w');
+fprintf(fileID, '%s\n', key);
+fclose(fileID);
+hit = true;
+end
+
+function root = defaultCacheRoot()
+root = string(getenv('SLPRJ_CACHE_ROOT'));
+if root == ""
+    root = fullfile(tempdir, "slprj_cache");
+end
+end
+
+function [hash, list] = hashSources(folder)
+%hashSources Hash the model sources of the folder and the MATLAB release,
+%and return the list of the hashed checksums
+files = [dir(fullfile(folder, '*.slx')); dir(fullfile(folder, '*.m')); ...
+    dir(fullfile(folder, '*.c')); dir(fullfile(folder, '*.h'))];
+files = files(~strcmp({files.name}, 'slprjCache.m'));
+[~, order] = sort({files.name});
+files = files(order);
+list = string(sprintf('%s %s\n', version('-release'), computer('arch')));
+for k = 1:numel(files)
+    list = list + sprintf('%s %s\n', files(k).name, ...
+        Simulink.getFileChecksum(fullfile(files(k).folder, files(k).name)));
+end
+listFile = [tempname '.txt'];
+fileID = fopen(listFile, 'w');
+fprintf(fileID, '%s', list);
+fclose(fileID);
+hash = string(Simulink.getFileChecksum(listFile));
+delete(listFile);
+end
+
+function key = checksumKey(folder, mexName)
+%checksumKey Return the overall checksum of the folder's S-function MEX
+key = "";
+if ~isfile(fullfile(folder, mexName + "." + mexext))
+    return;
+end
+% Do not call a loaded MEX of another folder
+unloadMex(mexName);
+oldFolder = cd(folder);
+restoreFolder = onCleanup(@() cd(oldFolder));
+checksums = feval(mexName, 'get_checksums');
+unloadMex(mexName);
+key = string(sprintf('%08x', uint32(checksums.overall)));
+end
+
+function unloadMex(mexName)
+%unloadMex Unlock and clear the MEX so that its file can be replaced
+[~, mexFiles] = inmem('-completenames');
+if any(endsWith(string(mexFiles), mexName + "." + mexext))
+    feval(mexName, 'mex_unlock');
+end
+clear(mexName);
+end
+
+function copyArtifacts(srcFolder, dstFolder, modelName)
+%copyArtifacts Copy the compiled S-function and the slprj code generation
+%and JIT outputs of the model from one folder to another
+files = [modelName + "_cgxe." + mexext, modelName + ".slxc", ...
+    fullfile("slprj", "sl_proj.tmw")];
+for k = 1:numel(files)
+    src = fullfile(srcFolder, files(k));
+    if isfile(src)
+        dst = fullfile(dstFolder, files(k));
+        if ~isfolder(fileparts(dst))
+            mkdir(fileparts(dst));
+        end
+        copyfile(src, dst, 'f');
+    end
+end
+dirs = ["_cprj" "_cgxe" "_jitprj" "accel"];
+for k = 1:numel(dirs)
+    src = fullfile(srcFolder, "slprj", dirs(k));
+    if isfolder(src)
+        dst = fullfile(dstFolder, "slprj", dirs(k));
+        if ~isfolder(dst)
+            mkdir(dst);
+        end
+        copyfile(src, dst, 'f');
+    end
+end
+end
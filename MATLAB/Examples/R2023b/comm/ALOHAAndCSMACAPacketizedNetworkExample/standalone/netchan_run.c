@@ -0,0 +1,369 @@
+/*
+ * netchan_run.c
+ *
+ * Headless batch runner for the channel of PacketizedNetworkSimulinkExample:
+ * the NetworkChannel fading engine (networkFading.c) of the six node links
+ * followed by the AWGN Channel S-function
+ * (slprj/_cprj/m_6ZqTk0OKN5QuhEtSrZC29B.c), both compiled into one native
+ * executable. The module translation unit is included directly, as in
+ * bench/awgn_bench.c, and linked against the minimal runtime in runtime/,
+ * which exits with the message identifier when the block raises an error.
+ * No MATLAB, MEX or JIT is involved.
+ *
+ *   netchan_run PARAMFILE     run every parameter set of PARAMFILE
+ *   netchan_run -             read the parameter sets from stdin
+ *
+ * Each non-empty line of the parameter file that does not start with '#'
+ * is one parameter set, given as whitespace-separated key=value pairs.
+ * Missing keys keep the model defaults:
+ *
+ *   name=S             label of the set in the output (default setN)
+ *   frames=N           number of frames (default 1000)
+ *   frameLength=N      samples per node and frame (default 80)
+ *   ebno=A,B,C         Eb/No of each receiver in dB (default 10,5,0)
+ *   signalPower=P      input signal power in W (default 1)
+ *   generator=G        0 for mt19937ar, 1 for Philox (default 0)
+ *   seed=S             AWGN seed (default 67)
+ *   sampleRate=A,B,C   sample rate of each transmitter in Hz
+ *                      (default 1000,2000,3000)
+ *   doppler=A,...,F    maximum Doppler shift of each link in Hz, in the
+ *                      NetworkChannel link order (default 10,20,30,20,30,40)
+ *   fadingSeed=S       seed of the fading links (default 73)
+ *
+ * All the sets run in this one process. For each set the block and the
+ * links are set up, the frames are generated from a unit-power QPSK source
+ * at each transmitter and pushed through the fused fading and AWGN step,
+ * and the block and the links are released. One CSV row is printed per
+ * set with the mean received power of each node and the run time.
+ */
+
+/* Include files */
+#include "m_6ZqTk0OKN5QuhEtSrZC29B.c"
+#include "networkFading.h"
+#include <stdio.h>
+#include <time.h>
+
+/* Named Constants */
+#define NETCHAN_MAX_LINE               (1024)
+#define NETCHAN_MAX_NAME               (64)
+
+/* Type Definitions */
+typedef struct {
+  char name[NETCHAN_MAX_NAME];
+  int32_T frames;
+  int32_T frameLength;
+  real_T EbNo[3];
+  real_T SignalPower;
+  real_T Generator;
+  real_T Seed;
+  real_T SampleRate[3];
+  real_T MaximumDopplerShift[6];
+  uint32_T FadingSeed;
+} netchanParams;
+
+typedef struct {
+  SimStruct S;
+  creal_T *u0;
+  creal_T *y0;
+  real_T EbNo[3];
+  real_T SignalPower;
+  real_T Generator;
+  real_T Seed;
+  real_T InstanceID;
+} netchanBlock;
+
+/* Function Definitions */
+static uint64_T netchanNowNs(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_T)ts.tv_sec * 1000000000UL + (uint64_T)ts.tv_nsec;
+}
+
+static void netchanDefaults(netchanParams *p, int32_T index)
+{
+  static const real_T maxDoppler[6] = { 10.0, 20.0, 30.0, 20.0, 30.0, 40.0 };
+
+  int32_T k;
+  memset(p, 0, sizeof(netchanParams));
+  snprintf(p->name, NETCHAN_MAX_NAME, "set%d", (int)index);
+  p->frames = 1000;
+  p->frameLength = 80;
+  p->EbNo[0] = 10.0;
+  p->EbNo[1] = 5.0;
+  p->EbNo[2] = 0.0;
+  p->SignalPower = 1.0;
+  p->Generator = 0.0;
+  p->Seed = 67.0;
+  for (k = 0; k < 3; k++) {
+    p->SampleRate[k] = 1000.0 * (real_T)(k + 1);
+  }
+
+  for (k = 0; k < 6; k++) {
+    p->MaximumDopplerShift[k] = maxDoppler[k];
+  }
+
+  p->FadingSeed = 73U;
+}
+
+static boolean_T netchanParseList(const char *s, real_T v[], int32_T n)
+{
+  char *end;
+  int32_T k;
+  for (k = 0; k < n; k++) {
+    v[k] = strtod(s, &end);
+    if (end == s || (k + 1 < n && *end != ',') || (k + 1 == n && *end != '\0'))
+    {
+      return false;
+    }
+
+    s = end + 1;
+  }
+
+  return true;
+}
+
+static boolean_T netchanParseLine(char *line, netchanParams *p)
+{
+  char *token;
+  char *value;
+  real_T v;
+  boolean_T ok;
+  for (token = strtok(line, " \t\r\n"); token != NULL; token = strtok(NULL,
+        " \t\r\n")) {
+    value = strchr(token, '=');
+    if (value == NULL) {
+      fprintf(stderr, "netchan_run: expected key=value, got \"%s\"\n", token);
+      return false;
+    }
+
+    *value++ = '\0';
+    if (strcmp(token, "name") == 0) {
+      snprintf(p->name, NETCHAN_MAX_NAME, "%s", value);
+      ok = true;
+    } else if (strcmp(token, "frames") == 0) {
+      ok = netchanParseList(value, &v, 1) && v >= 1.0;
+      p->frames = (int32_T)v;
+    } else if (strcmp(token, "frameLength") == 0) {
+      ok = netchanParseList(value, &v, 1) && v >= 1.0;
+      p->frameLength = (int32_T)v;
+    } else if (strcmp(token, "ebno") == 0) {
+      ok = netchanParseList(value, p->EbNo, 3);
+    } else if (strcmp(token, "signalPower") == 0) {
+      ok = netchanParseList(value, &p->SignalPower, 1) && p->SignalPower > 0.0;
+    } else if (strcmp(token, "generator") == 0) {
+      ok = netchanParseList(value, &p->Generator, 1) && (p->Generator == 0.0 ||
+        p->Generator == 1.0);
+    } else if (strcmp(token, "seed") == 0) {
+      ok = netchanParseList(value, &p->Seed, 1);
+    } else if (strcmp(token, "sampleRate") == 0) {
+      ok = netchanParseList(value, p->SampleRate, 3);
+    } else if (strcmp(token, "doppler") == 0) {
+      ok = netchanParseList(value, p->MaximumDopplerShift, 6);
+    } else if (strcmp(token, "fadingSeed") == 0) {
+      ok = netchanParseList(value, &v, 1) && v >= 0.0;
+      p->FadingSeed = (uint32_T)v;
+    } else {
+      fprintf(stderr, "netchan_run: unknown key \"%s\"\n", token);
+      return false;
+    }
+
+    if (!ok) {
+      fprintf(stderr, "netchan_run: invalid value \"%s\" for %s\n", value,
+              token);
+      return false;
+    }
+  }
+
+  return true;
+}
+
+static void netchanBlockStart(netchanBlock *b, const netchanParams *p)
+{
+  int32_T n;
+  n = 3 * p->frameLength;
+  memset(b, 0, sizeof(netchanBlock));
+  b->u0 = (creal_T *)calloc((size_t)n, sizeof(creal_T));
+  b->y0 = (creal_T *)calloc((size_t)n, sizeof(creal_T));
+  memcpy(b->EbNo, p->EbNo, sizeof(b->EbNo));
+  b->SignalPower = p->SignalPower;
+  b->Generator = p->Generator;
+  b->Seed = p->Seed;
+  b->InstanceID = 0.0;
+  b->S.inputs[0] = b->u0;
+  b->S.outputs[0] = b->y0;
+  b->S.inputWidth[0] = n;
+  b->S.numInputPorts = 1;
+  b->S.params[0] = b->EbNo;
+  b->S.params[1] = &b->SignalPower;
+  b->S.params[2] = &b->Generator;
+  b->S.params[3] = &b->Seed;
+  b->S.params[4] = &b->InstanceID;
+  b->S.numParams = 5;
+  method_dispatcher_6ZqTk0OKN5QuhEtSrZC29B(&b->S, SS_CALL_MDL_START, NULL);
+  mdlInitialize_6ZqTk0OKN5QuhEtSrZC29B(&b->S);
+}
+
+static void netchanBlockTerminate(netchanBlock *b)
+{
+  mdlTerminate_6ZqTk0OKN5QuhEtSrZC29B(&b->S);
+  free(b->u0);
+  free(b->y0);
+}
+
+static boolean_T netchanCreateLinks(const netchanParams *p, int32_T linkIds[6])
+{
+  static const real_T pathDelays3[3] = { 0.0, 0.001, 0.002 };
+
+  static const real_T pathDelays5[5] = { 0.0, 0.0032, 0.0036, 0.0053, 0.0096 };
+
+  static const real_T pathGains[5] = { 0.0, 0.0, 0.0, 0.0, 0.0 };
+
+  boolean_T ok;
+  int32_T k;
+  int32_T tx;
+
+  /* NetworkChannel defaults: column 1 of the 3-by-2 link grid is the */
+  /* 3-path profile, column 2 the 5-path profile. */
+  for (tx = 0; tx < 3; tx++) {
+    linkIds[tx] = networkFadingCreate(pathDelays3, pathGains, 3,
+      p->MaximumDopplerShift[tx], p->SampleRate[tx], p->FadingSeed);
+    linkIds[tx + 3] = networkFadingCreate(pathDelays5, pathGains, 5,
+      p->MaximumDopplerShift[tx + 3], p->SampleRate[tx], p->FadingSeed);
+  }
+
+  ok = true;
+  for (k = 0; k < 6; k++) {
+    ok = ok && linkIds[k] >= 0;
+  }
+
+  return ok;
+}
+
+static void netchanReleaseLinks(const int32_T linkIds[6])
+{
+  int32_T k;
+  for (k = 0; k < 6; k++) {
+    if (linkIds[k] >= 0) {
+      networkFadingRelease(linkIds[k]);
+    }
+  }
+}
+
+static void netchanSource(uint32_T *state, creal_T x[], int32_T n, real_T
+  amplitude)
+{
+  int32_T k;
+
+  /* Unit-power QPSK symbols from a 32-bit LCG, two bits per symbol. */
+  for (k = 0; k < n; k++) {
+    *state = *state * 1664525U + 1013904223U;
+    x[k].re = (*state & 0x80000000U) != 0U ? -amplitude : amplitude;
+    x[k].im = (*state & 0x40000000U) != 0U ? -amplitude : amplitude;
+  }
+}
+
+static boolean_T netchanRunSet(const netchanParams *p)
+{
+  netchanBlock b;
+  creal_T *x;
+  real_T power[3];
+  real_T amplitude;
+  uint64_T t0;
+  uint64_T t1;
+  int32_T linkIds[6];
+  int32_T f;
+  int32_T k;
+  int32_T n;
+  int32_T rx;
+  uint32_T state;
+  if (!netchanCreateLinks(p, linkIds)) {
+    fprintf(stderr, "netchan_run: %s: the fading engine rejected the links\n",
+            p->name);
+    netchanReleaseLinks(linkIds);
+    return false;
+  }
+
+  n = 3 * p->frameLength;
+  x = (creal_T *)malloc((size_t)n * sizeof(creal_T));
+  amplitude = sqrt(p->SignalPower / 2.0);
+  power[0] = 0.0;
+  power[1] = 0.0;
+  power[2] = 0.0;
+  state = p->FadingSeed;
+  t0 = netchanNowNs();
+  netchanBlockStart(&b, p);
+  for (f = 0; f < p->frames; f++) {
+    netchanSource(&state, x, n, amplitude);
+    fused_outputs_6ZqTk0OKN5QuhEtSrZC29B(&b.S, x, linkIds);
+    for (rx = 0; rx < 3; rx++) {
+      for (k = rx * p->frameLength; k < (rx + 1) * p->frameLength; k++) {
+        power[rx] += b.y0[k].re * b.y0[k].re + b.y0[k].im * b.y0[k].im;
+      }
+    }
+  }
+
+  netchanBlockTerminate(&b);
+  t1 = netchanNowNs();
+  netchanReleaseLinks(linkIds);
+  free(x);
+  for (rx = 0; rx < 3; rx++) {
+    power[rx] /= (real_T)p->frames * (real_T)p->frameLength;
+  }
+
+  printf("%s,%d,%d,%.9g,%.9g,%.9g,%.6f\n", p->name, (int)p->frames, (int)
+         p->frameLength, power[0], power[1], power[2], (real_T)(t1 - t0) * 1e-9);
+  fflush(stdout);
+  return true;
+}
+
+int main(int argc, char *argv[])
+{
+  static char line[NETCHAN_MAX_LINE];
+  netchanParams p;
+  FILE *file;
+  char *s;
+  int32_T failures;
+  int32_T lineNumber;
+  int32_T numSets;
+  if (argc != 2) {
+    fprintf(stderr, "usage: netchan_run PARAMFILE | -\n");
+    return 2;
+  }
+
+  file = strcmp(argv[1], "-") == 0 ? stdin : fopen(argv[1], "r");
+  if (file == NULL) {
+    fprintf(stderr, "netchan_run: cannot open %s\n", argv[1]);
+    return 2;
+  }
+
+  printf("name,frames,frameLength,rxPower1,rxPower2,rxPower3,seconds\n");
+  failures = 0;
+  lineNumber = 0;
+  numSets = 0;
+  while (fgets(line, NETCHAN_MAX_LINE, file) != NULL) {
+    lineNumber++;
+    for (s = line; *s == ' ' || *s == '\t'; s++) {
+    }
+
+    if (*s == '#' || *s == '\n' || *s == '\r' || *s == '\0') {
+      continue;
+    }
+
+    numSets++;
+    netchanDefaults(&p, numSets);
+    if (!netchanParseLine(s, &p)) {
+      fprintf(stderr, "netchan_run: %s:%d: skipped\n", argv[1], (int)
+              lineNumber);
+      failures++;
+    } else if (!netchanRunSet(&p)) {
+      failures++;
+    }
+  }
+
+  if (file != stdin) {
+    fclose(file);
+  }
+
+  return failures == 0 ? 0 : 1;
+}
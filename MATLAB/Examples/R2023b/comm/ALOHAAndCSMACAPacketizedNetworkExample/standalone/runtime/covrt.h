@@ -0,0 +1,2 @@
+/* Standalone runtime stand-in for covrt.h: nothing from it is */
+/* used by the AWGN module. */
@@ -0,0 +1,332 @@
+/* Minimal Simulink, MEX, MATLAB Coder and cgxe runtime for netchan_run. */
+/* Parameters and ports are read straight from the SimStruct fields. The */
+/* module raises its errors through MATLAB error() and */
+/* emlrtErrorWithMessageIdR2018a, which do not return in Simulink; here the */
+/* message identifier is printed and the process exits with status 1. */
+#include <stdarg.h>
+#include "simstruc.h"
+#include "emlrt.h"
+#include "cgxert.h"
+
+/* Named Constants */
+#define NETCHAN_NUM_ARRAYS             (8)
+#define NETCHAN_MAX_TEXT               (128)
+
+/* Type Definitions */
+struct mxArray_tag
+{
+  char_T text[NETCHAN_MAX_TEXT];
+};
+
+/* Variable Definitions */
+static mxArray netchanArrays[NETCHAN_NUM_ARRAYS];
+static int32_T netchanNextArray = 0;
+
+/* Function Definitions */
+void ssSetmdlOutputs(SimStruct *S, mdlOutputsFcn f)
+{
+  (void)S;
+  (void)f;
+}
+
+void ssSetmdlInitializeConditions(SimStruct *S, mdlVoidFcn f)
+{
+  (void)S;
+  (void)f;
+}
+
+void ssSetmdlUpdate(SimStruct *S, mdlUpdateFcn f)
+{
+  (void)S;
+  (void)f;
+}
+
+void ssSetmdlDerivatives(SimStruct *S, mdlVoidFcn f)
+{
+  (void)S;
+  (void)f;
+}
+
+void ssSetmdlTerminate(SimStruct *S, mdlVoidFcn f)
+{
+  (void)S;
+  (void)f;
+}
+
+void ssSetmdlEnable(SimStruct *S, mdlVoidFcn f)
+{
+  (void)S;
+  (void)f;
+}
+
+void ssSetmdlDisable(SimStruct *S, mdlVoidFcn f)
+{
+  (void)S;
+  (void)f;
+}
+
+uint_T ssGetOptions(SimStruct *S)
+{
+  return S->options;
+}
+
+void ssSetOptions(SimStruct *S, uint_T o)
+{
+  S->options = o;
+}
+
+int_T ssGetInputPortWidth(SimStruct *S, int_T port)
+{
+  return S->inputWidth[port];
+}
+
+int_T ssGetNumInputPorts(SimStruct *S)
+{
+  return S->numInputPorts;
+}
+
+int_T ssGetNumRunTimeParams(SimStruct *S)
+{
+  return S->numParams;
+}
+
+/* Checksums of the generated module, which the module reports for */
+/* itself. */
+uint32_T ssGetChecksum0(SimStruct *S)
+{
+  (void)S;
+  return 3555681173U;
+}
+
+uint32_T ssGetChecksum1(SimStruct *S)
+{
+  (void)S;
+  return 210201439U;
+}
+
+uint32_T ssGetChecksum2(SimStruct *S)
+{
+  (void)S;
+  return 3739409047U;
+}
+
+uint32_T ssGetChecksum3(SimStruct *S)
+{
+  (void)S;
+  return 1544329537U;
+}
+
+int mexPrintf(const char *fmt, ...)
+{
+  va_list args;
+  int n;
+  va_start(args, fmt);
+  n = vprintf(fmt, args);
+  va_end(args);
+  return n;
+}
+
+/* The module only builds MATLAB arrays for its build information and its */
+/* error messages: every array is a text buffer taken from a small ring, */
+/* which is enough for the identifier and the arguments of one message. */
+static mxArray *netchanNewArray(void)
+{
+  mxArray *a;
+  a = &netchanArrays[netchanNextArray];
+  netchanNextArray = (netchanNextArray + 1) % NETCHAN_NUM_ARRAYS;
+  a->text[0] = '\0';
+  return a;
+}
+
+mxArray *mxCreateCellMatrix(size_t m, size_t n)
+{
+  (void)m;
+  (void)n;
+  return netchanNewArray();
+}
+
+mxArray *mxCreateString(const char *s)
+{
+  mxArray *a;
+  a = netchanNewArray();
+  snprintf(a->text, NETCHAN_MAX_TEXT, "%s", s);
+  return a;
+}
+
+void mxSetCell(mxArray *c, size_t i, mxArray *v)
+{
+  (void)c;
+  (void)i;
+  (void)v;
+}
+
+mxArray *mxCreateDoubleMatrix(size_t m, size_t n, mxComplexity c)
+{
+  (void)m;
+  (void)n;
+  (void)c;
+  return netchanNewArray();
+}
+
+double *mxGetPr(const mxArray *a)
+{
+  (void)a;
+  return NULL;
+}
+
+mxArray *mxCreateStructMatrix(size_t m, size_t n, int nf, const char **f)
+{
+  (void)m;
+  (void)n;
+  (void)nf;
+  (void)f;
+  return netchanNewArray();
+}
+
+void mxSetFieldByNumber(mxArray *s, size_t i, int f, mxArray *v)
+{
+  (void)s;
+  (void)i;
+  (void)f;
+  (void)v;
+}
+
+double mxGetInf(void)
+{
+  return HUGE_VAL;
+}
+
+double mxGetNaN(void)
+{
+  return nan("");
+}
+
+int mxIsNaN(double x)
+{
+  return isnan(x);
+}
+
+int mxIsInf(double x)
+{
+  return isinf(x);
+}
+
+const mxArray *emlrtCreateCharArray(int32_T ndims, const int32_T *dims)
+{
+  (void)ndims;
+  (void)dims;
+  return netchanNewArray();
+}
+
+void emlrtInitCharArrayR2013a(emlrtConstCTX ctx, int32_T n, const mxArray *m,
+  const char_T *s)
+{
+  int32_T len;
+  (void)ctx;
+  len = n < NETCHAN_MAX_TEXT - 1 ? n : NETCHAN_MAX_TEXT - 1;
+  memcpy(((mxArray *)m)->text, s, (size_t)len);
+  ((mxArray *)m)->text[len] = '\0';
+}
+
+void emlrtAssign(const mxArray **dst, const mxArray *src)
+{
+  *dst = src;
+}
+
+/* message() and getString() hand back the message identifier, so that */
+/* error() reports the identifier of the message. */
+const mxArray *emlrtCallMATLABR2012b(emlrtConstCTX ctx, int32_T nlhs, const
+  mxArray **plhs, int32_T nrhs, const mxArray **prhs, const char *name,
+  boolean_T b, emlrtMCInfo *loc)
+{
+  (void)ctx;
+  (void)nlhs;
+  (void)plhs;
+  (void)b;
+  if (strcmp(name, "error") == 0) {
+    fprintf(stderr, "netchan_run: error %s", nrhs > 0 ? prhs[0]->text : "");
+    if (loc != NULL) {
+      fprintf(stderr, " (%s)", loc->fName);
+    }
+
+    fprintf(stderr, "\n");
+    exit(1);
+  }
+
+  return nrhs > 0 ? prhs[0] : netchanNewArray();
+}
+
+void emlrtErrorWithMessageIdR2018a(const void *aTLS, const emlrtRTEInfo *aInfo,
+  const char *aMsgID, const char *aReportID, int32_T aArgCount, ...)
+{
+  (void)aTLS;
+  (void)aReportID;
+  (void)aArgCount;
+  fprintf(stderr, "netchan_run: error %s", aMsgID);
+  if (aInfo != NULL) {
+    fprintf(stderr, " (%s)", aInfo->fName);
+  }
+
+  fprintf(stderr, "\n");
+  exit(1);
+}
+
+void emlrtLicenseCheckR2022a(emlrtConstCTX ctx, const char *id, const char *tb,
+  int32_T x)
+{
+  (void)ctx;
+  (void)id;
+  (void)tb;
+  (void)x;
+}
+
+void *cgxertGetRunTimeParamInfoData(SimStruct *S, int_T idx)
+{
+  return S->params[idx];
+}
+
+void cgxertSetSimStateCompliance(SimStruct *S, int_T v)
+{
+  (void)S;
+  (void)v;
+}
+
+void cgxertSetGcb(SimStruct *S, int_T a, int_T b)
+{
+  (void)S;
+  (void)a;
+  (void)b;
+}
+
+void cgxertRestoreGcb(SimStruct *S, int_T a, int_T b)
+{
+  (void)S;
+  (void)a;
+  (void)b;
+}
+
+void *cgxertGetEMLRTCtx(SimStruct *S)
+{
+  (void)S;
+  return NULL;
+}
+
+void *cgxertGetInputPortSignal(SimStruct *S, int_T port)
+{
+  return S->inputs[port];
+}
+
+void *cgxertGetOutputPortSignal(SimStruct *S, int_T port)
+{
+  return S->outputs[port];
+}
+
+void *cgxertGetRuntimeInstance(SimStruct *S)
+{
+  return S->instance;
+}
+
+void cgxertSetRuntimeInstance(SimStruct *S, void *p)
+{
+  S->instance = p;
+}
@@ -0,0 +1,2 @@
+/* Standalone runtime stand-in for slccrt.h: nothing from it is */
+/* used by the AWGN module. */
@@ -0,0 +1,2 @@
+/* Standalone runtime stand-in for slexec_vm_simstruct_bridge.h: nothing from it is */
+/* used by the AWGN module. */
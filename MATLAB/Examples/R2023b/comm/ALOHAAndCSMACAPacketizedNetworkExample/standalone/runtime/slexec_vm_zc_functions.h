@@ -0,0 +1,2 @@
+/* Standalone runtime stand-in for slexec_vm_zc_functions.h: nothing from it is */
+/* used by the AWGN module. */
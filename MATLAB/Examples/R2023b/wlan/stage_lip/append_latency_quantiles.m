@@ -0,0 +1,24 @@
+function append_latency_quantiles(quantilesFile, resultRow, quantileRow)
+    % append_latency_quantiles(QUANTILESFILE, RESULTROW, QUANTILEROW)
+    % appends one row to the CSV file QUANTILESFILE: the rate, the duration
+    % and the flow of the simulate_simple result row RESULTROW, followed by
+    % QUANTILEROW, the p50, p90, p99 and p99.9 of the end-to-end latency and
+    % then those of the MAC queueing delay, in seconds. The file is created
+    % with its header if it does not exist.
+    %
+    % simulate_simple and run_sweep both write their quantiles with this
+    % function, so that the files have the same columns.
+    arguments
+        quantilesFile (1,1) string
+        resultRow string
+        quantileRow (1,8) double
+    end
+
+    if ~isfile(quantilesFile)
+        headers = ["Arrival Rate (pps)", "Simulation Duration (s)", "Flow Direction", ...
+            "Delay p50 (s)", "Delay p90 (s)", "Delay p99 (s)", "Delay p99.9 (s)", ...
+            "Queueing p50 (s)", "Queueing p90 (s)", "Queueing p99 (s)", "Queueing p99.9 (s)"];
+        writematrix(headers, quantilesFile);
+    end
+    writematrix([resultRow(1:3) quantileRow], quantilesFile, 'WriteMode', 'append');
+end
@@ -0,0 +1,59 @@
+function append_results_store(storeFile, resultRows, options)
+    % append_results_store(STOREFILE, RESULTROWS) appends the simulate_simple
+    % result rows RESULTROWS ([rate, duration, flow, sent, received, latency,
+    % throughput], one row per run) to the binary results store STOREFILE,
+    % shared with the ns-3 and iperf runs. The file is created with its
+    % header if it does not exist.
+    %
+    % The layout is defined in digital_twins/results_store.py: a 32 byte
+    % header, then one 72 byte little-endian record per row with the tool,
+    % the scenario, the flow, the duration, the rate, the packet counts, the
+    % delay, the throughput and the jitter (NaN for MATLAB). Missing packet
+    % counts are stored as -1 and the other missing values as NaN, as in
+    % results_store.py.
+    %
+    % append_results_store(..., Scenario=S) sets the scenario number. The
+    % default is 1.
+    arguments
+        storeFile (1,1) string
+        resultRows string
+        options.Scenario (1,1) double {mustBeInteger, mustBeNonnegative} = 1
+    end
+
+    magic = uint8('DTRSTORE');
+    version = 1;
+    recordSize = 72;
+    toolMATLAB = 2;
+
+    if startsWith(storeFile, "~")
+        storeFile = string(getenv("HOME")) + extractAfter(storeFile, 1);
+    end
+    if ~isfile(storeFile)
+        fileID = fopen(storeFile, 'w', 'ieee-le');
+        fwrite(fileID, [magic typecast(uint32([version recordSize]), 'uint8') zeros(1, 16, 'uint8')], 'uint8');
+        fclose(fileID);
+    end
+
+    % Build all the records, then append them with one write
+    numRows = size(resultRows, 1);
+    records = zeros(recordSize, numRows, 'uint8');
+    for k = 1:numRows
+        flow = zeros(1, 12, 'uint8');
+        flowBytes = uint8(char(resultRows(k, 3)));
+        if numel(flowBytes) > 12
+            error("append_results_store:FlowTooLong", "Flow %s is longer than 12 bytes.", resultRows(k, 3));
+        end
+        flow(1:numel(flowBytes)) = flowBytes;
+        values = str2double(resultRows(k, [2 1 4 5 6 7]));
+        % int64(NaN) is 0, so the missing counts are set explicitly
+        counts = values(3:4);
+        counts(isnan(counts)) = -1;
+        records(:, k) = [uint8([toolMATLAB options.Scenario 0 0]) flow ...
+            typecast(values(1:2), 'uint8') typecast(int64(counts), 'uint8') ...
+            typecast([values(5:6) NaN], 'uint8')]';
+    end
+
+    fileID = fopen(storeFile, 'a', 'ieee-le');
+    fwrite(fileID, records, 'uint8');
+    fclose(fileID);
+end
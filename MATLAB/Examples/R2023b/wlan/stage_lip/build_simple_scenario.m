@@ -0,0 +1,93 @@
+function scenario = build_simple_scenario(networkSimulator, key)
+    % SCENARIO = build_simple_scenario(NETWORKSIMULATOR, KEY) builds the
+    % simulate_simple topology, an AP and one STA, and adds its channel
+    % model to NETWORKSIMULATOR. KEY is a structure with the STA position
+    % (Position), the PHY abstraction ("none" or "calibrated") and the PER
+    % table file used by the calibrated abstraction (PERTableFile). The
+    % random numbers of the topology are drawn from the global stream, so
+    % seed it before build_simple_scenario. KEY can carry other fields, such
+    % as the seed, which only tell hWLANScenarioBatch snapshots apart.
+    %
+    % SCENARIO has the fields Nodes (all the nodes), AP and STAs. The nodes
+    % are associated but have no traffic source and are not added to the
+    % simulator. build_simple_scenario is the build function of the
+    % hWLANScenarioBatch used by simulate_simple and run_sweep.
+
+    % Modeling full MAC and PHY processing, or abstracted MAC and PHY
+    % calibrated against the full PHY
+    if key.PHYAbstraction == "calibrated"
+        if ~isfile(key.PERTableFile)
+            error("simulate_simple:PERTableNotFound", "PER table %s not found. Generate it with hGeneratePHYAbstractionTable.", key.PERTableFile);
+        end
+        perTable = load(key.PERTableFile, "perTable").perTable;
+        MACFrameAbstraction = true;
+        PHYAbstractionMethod = "tgax-mac-calibration";
+    else
+        perTable = [];
+        MACFrameAbstraction = false;
+        PHYAbstractionMethod = "none";
+    end
+
+    % Buffer Size
+    bufferSize = 500;
+
+    % Number of Nodes
+    numNodes = 2;
+    numSTAs = numNodes - 1;
+
+    % Nodes Positions
+    apPosition = [0 0 0];
+    % staPositions = [((30/numSTAs) .* (1:numSTAs))', ((30/numSTAs) .* (numSTAs:-1:1))', zeros(numSTAs,1)];
+    staPositions = key.Position;
+    disp(staPositions(1))
+
+    % Nodes Configuration
+    apConfig = wlanDeviceConfig(Mode="AP", ...
+        MCS=1, ...
+        ChannelBandwidth=20000000, ...
+        TransmissionFormat="HT-Mixed", ...
+        TransmitQueueSize=bufferSize); % AP device configuration
+    staConfig = wlanDeviceConfig(Mode="STA", ...
+        MCS=1, ...
+        ChannelBandwidth=20000000, ...
+        TransmissionFormat="HT-Mixed", ...
+        TransmitPower=16.02, ...
+        TransmitQueueSize=bufferSize);    % STA device configuration
+
+    % Create Nodes
+    apNode = wlanNode(Name="AP", Position=apPosition, DeviceConfig=apConfig, PHYAbstractionMethod=PHYAbstractionMethod, MACFrameAbstraction=MACFrameAbstraction);
+    staNodes = wlanNode(Name="STA"+(1:numSTAs), Position=staPositions, DeviceConfig=staConfig, PHYAbstractionMethod=PHYAbstractionMethod, MACFrameAbstraction=MACFrameAbstraction);
+
+    % Create WLAN Network
+    nodes = [apNode staNodes];
+
+    % Verify configuration
+    hCheckWLANNodesConfiguration(nodes);
+
+    % Associate Stations
+    associateStations(apNode, staNodes);
+
+    % Wireless Channel
+        % The 802.11n channel object uses a filtered Gaussian noise model in which
+        % ...the path delays, powers, angular spread, angles of arrival, and angles of departure
+        % ...are determined empirically. The specific modeling approach is described in [1].
+        % TransmitReceiveDistance is used to compute the path loss, and to determine whether the channel has
+        % ...a line of sight (LOS) or non line of sight (NLOS) condition. The path loss
+        % ...and standard deviation of shadow fading loss depend on the separation between the transmitter and the receiver.
+        % Model-A : d_BP = 5m -> path_loss exponent = 3.5, shadow_fading std = 4 max_delay=0ns
+        % ...ref: https://fr.mathworks.com/help/wlan/ref/wlantgnchannel-system-object.html
+    tgnChan = wlanTGnChannel('DelayProfile','Model-A', ...
+                    'TransmitReceiveDistance',staPositions(1),...
+                    'LargeScaleFadingEffect','Pathloss', ...    % 'None' (default) | 'Pathloss' | 'Shadowing' | 'Pathloss and shadowing'
+                    'ChannelFiltering', false, ...
+                    'NumSamples', 80, ...
+                    'EnvironmentalSpeed', 0);   % Speed of the scatterers (diffuseurs : batiments, vehicules, etc.) in km/h
+    if isempty(perTable)
+        channel = hSLSTGaxMultiFrequencySystemChannel(nodes, tgnChan);
+    else
+        channel = hSLSTGaxMultiFrequencySystemChannel(nodes, tgnChan, PERTable=perTable);
+    end
+    addChannelModel(networkSimulator, channel.ChannelFcn, channel.PathLossFcn);
+
+    scenario = struct(Nodes=nodes, AP=apNode, STAs=staNodes);
+end
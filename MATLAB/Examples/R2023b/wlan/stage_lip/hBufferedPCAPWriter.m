@@ -0,0 +1,280 @@
+classdef hBufferedPCAPWriter < handle
+%hBufferedPCAPWriter Streaming PCAP/PCAPNG writer with buffered output
+%
+%   OBJ = hBufferedPCAPWriter(FILENAME, FILEEXTENSION, RADIOTAPPRESENT)
+%   creates the file FILENAME.FILEEXTENSION and writes its PCAP or PCAPNG
+%   header. FILEEXTENSION is "pcap" or "pcapng". If RADIOTAPPRESENT is true,
+%   the link type is IEEE 802.11 with radiotap header, otherwise IEEE
+%   802.11.
+%
+%   OBJ = hBufferedPCAPWriter(..., Name=Value) specifies these options:
+%
+%   BufferSize     - Size of the output buffer in bytes. Records are
+%                    collected in a preallocated buffer and written to the
+%                    file once it is full. The default is 4 MiB.
+%   SnapLength     - Maximum number of bytes captured from each frame,
+%                    after the radiotap header. Longer frames are truncated
+%                    and keep their original length in the record header.
+%                    Set to 24, for example, to capture only MAC headers.
+%                    The default is 65535.
+%   SampleInterval - Capture one frame out of every SampleInterval frames.
+%                    The default is 1.
+%   MaxRadiotapLength - Maximum length in bytes of the radiotap header of
+%                    a frame, when RADIOTAPPRESENT is true. The snap length
+%                    in the file header is SnapLength plus
+%                    MaxRadiotapLength, so that no record is longer than
+%                    the snap length. The default is 256.
+%   MemoryMapSize  - Size in bytes of the preallocated file, when the file
+%                    is memory-mapped. The records are copied into a
+%                    memmapfile of the file instead of the output buffer,
+%                    and the operating system writes them back. The file
+%                    is grown by remapping it at twice the size when it is
+%                    full, and cut to the written length when the object
+%                    is deleted. The default is 0, which writes through the
+%                    output buffer instead.
+%
+%   hBufferedPCAPWriter methods:
+%
+%   write - Write a frame with a timestamp in microseconds, as
+%           wlanPCAPWriter
+%   flush - Write the buffered records to the file
+%
+%   The file is flushed and closed when the object is deleted.
+
+    properties (SetAccess = private)
+        %FileName Name of the capture file, including the extension
+        FileName
+
+        %BufferSize Size of the output buffer in bytes
+        BufferSize = 4*2^20
+
+        %SnapLength Maximum number of captured bytes of each frame
+        SnapLength = 65535
+
+        %SampleInterval Capture one frame out of every SampleInterval frames
+        SampleInterval = 1
+
+        %MaxRadiotapLength Maximum length of the radiotap header of a frame,
+        %0 if the link type has no radiotap header
+        MaxRadiotapLength = 0
+
+        %MemoryMapSize Size of the preallocated memory-mapped file in
+        %bytes, 0 if the file is not memory-mapped
+        MemoryMapSize = 0
+
+        %NumFramesWritten Number of frames written
+        NumFramesWritten = 0
+    end
+
+    properties (Access = private)
+        %pFileID File identifier
+        pFileID = -1
+
+        %pIsPCAPNG Flag indicating PCAPNG format
+        pIsPCAPNG = false
+
+        %pBuffer Preallocated output buffer
+        pBuffer
+
+        %pBufferLength Number of bytes used in the output buffer
+        pBufferLength = 0
+
+        %pNumFramesSeen Number of frames passed to write
+        pNumFramesSeen = 0
+
+        %pIsMapped Flag indicating the file is memory-mapped and open
+        pIsMapped = false
+
+        %pMap memmapfile of the file, when memory-mapped
+        pMap = []
+
+        %pMapLength Number of bytes written to the memory-mapped file
+        pMapLength = 0
+    end
+
+    properties (Constant, Access = private)
+        % Link types
+        LinkTypeIEEE80211 = 105
+        LinkTypeRadiotap = 127
+
+        % Size of the fixed record headers in bytes
+        PCAPRecordHeaderLength = 16
+        PCAPNGRecordHeaderLength = 28
+    end
+
+    methods
+        function obj = hBufferedPCAPWriter(fileName, fileExtension, radiotapPresent, options)
+            arguments
+                fileName (1,1) string
+                fileExtension (1,1) string {mustBeMember(fileExtension, ["pcap" "pcapng"])} = "pcap"
+                radiotapPresent (1,1) logical = false
+                options.BufferSize (1,1) double {mustBeInteger, mustBePositive} = 4*2^20
+                options.SnapLength (1,1) double {mustBeInteger, mustBePositive} = 65535
+                options.SampleInterval (1,1) double {mustBeInteger, mustBePositive} = 1
+                options.MaxRadiotapLength (1,1) double {mustBeInteger, mustBeNonnegative} = 256
+                options.MemoryMapSize (1,1) double {mustBeInteger, mustBeNonnegative} = 0
+            end
+
+            obj.FileName = fileName + "." + fileExtension;
+            obj.BufferSize = options.BufferSize;
+            obj.SnapLength = options.SnapLength;
+            obj.SampleInterval = options.SampleInterval;
+            if radiotapPresent
+                obj.MaxRadiotapLength = options.MaxRadiotapLength;
+            end
+            obj.pIsPCAPNG = fileExtension == "pcapng";
+            obj.MemoryMapSize = options.MemoryMapSize;
+
+            obj.pFileID = fopen(obj.FileName, 'w', 'ieee-le');
+            if obj.pFileID < 0
+                error("hBufferedPCAPWriter:FileOpenFailed", "Unable to create the file %s.", obj.FileName);
+            end
+            if obj.MemoryMapSize > 0
+                % Preallocate the file and map it; the output buffer is
+                % not used
+                fclose(obj.pFileID);
+                obj.pFileID = -1;
+                mapFile(obj, obj.MemoryMapSize);
+                obj.pIsMapped = true;
+            else
+                obj.pBuffer = zeros(obj.BufferSize, 1, 'uint8');
+            end
+
+            % Write the file header
+            if radiotapPresent
+                linkType = obj.LinkTypeRadiotap;
+            else
+                linkType = obj.LinkTypeIEEE80211;
+            end
+            snapLength = obj.SnapLength + obj.MaxRadiotapLength;
+            if obj.pIsPCAPNG
+                % Section header block, no options, section length unknown
+                shb = [typecast(uint32([hex2dec('0A0D0D0A') 28 hex2dec('1A2B3C4D')]), 'uint8') ...
+                    typecast(uint16([1 0]), 'uint8') typecast(int64(-1), 'uint8') ...
+                    typecast(uint32(28), 'uint8')];
+                % Interface description block, microsecond timestamps
+                idb = [typecast(uint32([1 20]), 'uint8') typecast(uint16([linkType 0]), 'uint8') ...
+                    typecast(uint32([snapLength 20]), 'uint8')];
+                appendBytes(obj, [shb idb]');
+            else
+                header = [typecast(uint32(hex2dec('A1B2C3D4')), 'uint8') typecast(uint16([2 4]), 'uint8') ...
+                    typecast(uint32([0 0 snapLength linkType]), 'uint8')];
+                appendBytes(obj, header');
+            end
+        end
+
+        function write(obj, packet, timestamp, varargin)
+            %write Write a frame to the capture file
+            %
+            %   write(OBJ, PACKET, TIMESTAMP) writes the frame PACKET, a
+            %   vector of bytes in decimal format, with the capture time
+            %   TIMESTAMP in microseconds.
+            %
+            %   write(OBJ, PACKET, TIMESTAMP, 'Radiotap', RADIOTAP) prepends
+            %   the radiotap header bytes RADIOTAP to the frame. RADIOTAP is
+            %   at most MaxRadiotapLength bytes long.
+
+            obj.pNumFramesSeen = obj.pNumFramesSeen + 1;
+            if mod(obj.pNumFramesSeen - 1, obj.SampleInterval) ~= 0
+                return;
+            end
+
+            radiotap = zeros(0, 1);
+            if numel(varargin) >= 2 && strcmpi(varargin{1}, 'Radiotap')
+                radiotap = varargin{2}(:);
+            end
+            if numel(radiotap) > obj.MaxRadiotapLength
+                error("hBufferedPCAPWriter:RadiotapTooLong", "The radiotap header of %d bytes is longer than MaxRadiotapLength (%d).", ...
+                    numel(radiotap), obj.MaxRadiotapLength);
+            end
+            packet = packet(:);
+            numFrameBytes = numel(packet);
+            numCapturedBytes = min(numFrameBytes, obj.SnapLength);
+            originalLength = numel(radiotap) + numFrameBytes;
+            capturedLength = numel(radiotap) + numCapturedBytes;
+
+            timestamp = round(timestamp);
+            if obj.pIsPCAPNG
+                % Enhanced packet block, captured data padded to 32 bits
+                numPadBytes = mod(-capturedLength, 4);
+                blockLength = obj.PCAPNGRecordHeaderLength + capturedLength + numPadBytes + 4;
+                timestamp = uint64(timestamp);
+                recordHeader = typecast(uint32([6 blockLength 0 ...
+                    bitshift(timestamp, -32) bitand(timestamp, uint64(2^32-1)) ...
+                    capturedLength originalLength]), 'uint8');
+                recordTrailer = [zeros(1, numPadBytes, 'uint8') typecast(uint32(blockLength), 'uint8')];
+            else
+                recordHeader = typecast(uint32([floor(timestamp/1e6) mod(timestamp, 1e6) ...
+                    capturedLength originalLength]), 'uint8');
+                recordTrailer = zeros(1, 0, 'uint8');
+            end
+
+            appendBytes(obj, [recordHeader'; uint8(radiotap); uint8(packet(1:numCapturedBytes)); recordTrailer']);
+            obj.NumFramesWritten = obj.NumFramesWritten + 1;
+        end
+
+        function flush(obj)
+            %flush Write the buffered records to the file. A memory-mapped
+            %file has no output buffer.
+            if obj.pBufferLength > 0
+                fwrite(obj.pFileID, obj.pBuffer(1:obj.pBufferLength), 'uint8');
+                obj.pBufferLength = 0;
+            end
+        end
+
+        function delete(obj)
+            if obj.pIsMapped
+                % Unmap the file and cut the unused preallocated bytes
+                obj.pMap = [];
+                setFileLength(obj.FileName, obj.pMapLength);
+                obj.pIsMapped = false;
+            end
+            if obj.pFileID >= 0
+                flush(obj);
+                fclose(obj.pFileID);
+                obj.pFileID = -1;
+            end
+        end
+    end
+
+    methods (Access = private)
+        function appendBytes(obj, bytes)
+            %appendBytes Add bytes to the output buffer, writing the buffer
+            %to the file when it is full
+            numBytes = numel(bytes);
+            if obj.pIsMapped
+                if obj.pMapLength + numBytes > numel(obj.pMap.Data)
+                    mapFile(obj, max(2*numel(obj.pMap.Data), obj.pMapLength + numBytes));
+                end
+                obj.pMap.Data(obj.pMapLength+1:obj.pMapLength+numBytes) = bytes;
+                obj.pMapLength = obj.pMapLength + numBytes;
+                return;
+            end
+            if obj.pBufferLength + numBytes > obj.BufferSize
+                flush(obj);
+                if numBytes > obj.BufferSize
+                    % Larger than the whole buffer, write directly
+                    fwrite(obj.pFileID, bytes, 'uint8');
+                    return;
+                end
+            end
+            obj.pBuffer(obj.pBufferLength+1:obj.pBufferLength+numBytes) = bytes;
+            obj.pBufferLength = obj.pBufferLength + numBytes;
+        end
+
+        function mapFile(obj, numBytes)
+            %mapFile Set the length of the file to NUMBYTES and map it. The
+            %previous mapping is released first.
+            obj.pMap = [];
+            setFileLength(obj.FileName, numBytes);
+            obj.pMap = memmapfile(obj.FileName, Writable=true, Format="uint8");
+        end
+    end
+end
+
+function setFileLength(fileName, numBytes)
+%setFileLength Extend or truncate a file to NUMBYTES bytes
+    file = java.io.RandomAccessFile(char(fileName), 'rw');
+    closeFile = onCleanup(@() file.close());
+    file.setLength(numBytes);
+end
@@ -22,6 +22,26 @@ classdef hExportWLANPackets < handle
 %   true. The second and third arguments of this syntax can be interchanged
 %   and specified independently of each other.
 %
+%   OBJ = hExportWLANPackets(..., Name=Value) specifies streaming options
+%   after the positional arguments:
+%
+%   Streaming      - If true, write the frames with hBufferedPCAPWriter,
+%                    which collects the records in a preallocated buffer
+%                    and writes it to the file in large blocks, instead of
+%                    wlanPCAPWriter. The default is false.
+%   BufferSize     - Size of the output buffer of each file in bytes, when
+%                    Streaming is true. The default is 4 MiB.
+%   SnapLength     - Maximum number of bytes captured from each MAC frame,
+%                    when Streaming is true. Set to 24, for example, to
+%                    capture only the MAC headers. The default is 65535.
+%   SampleInterval - Capture one frame out of every SampleInterval frames
+%                    of each node, when Streaming is true. The default is
+%                    1.
+%   MemoryMapSize  - Preallocated size in bytes of each file, which is then
+%                    written through a memmapfile, when Streaming is true.
+%                    The default is 0, which writes through the output
+%                    buffer instead.
+%
 %   WLANNODES is an array or cell array of objects of type <a
 %   href="matlab:help('wlanNode')">wlanNode</a>.
 %
@@ -38,7 +58,8 @@ classdef hExportWLANPackets < handle
 %
 %   hExportWLANPackets properties (read-only):
 %
-%   PCAPObjList             - Array of objects of type wlanPCAPWriter
+%   PCAPObjList             - Array of objects of type wlanPCAPWriter or
+%                             hBufferedPCAPWriter
 %   WLANNodes               - Configured WLAN Nodes in the network
 
 %   Copyright 2022-2023 The MathWorks, Inc.
@@ -46,7 +67,8 @@ classdef hExportWLANPackets < handle
     properties(GetAccess = public, SetAccess = private)
         %PCAPObjList Array of objects of type wlanPCAPWriter
         %   This property is an array of objects of type <a
-        %   href="matlab:help('wlanPCAPWriter')">wlanPCAPWriter</a>
+        %   href="matlab:help('wlanPCAPWriter')">wlanPCAPWriter</a>, or of
+        %   type hBufferedPCAPWriter when streaming is enabled
         PCAPObjList;
 
         %WLANNodes Configured WLAN Nodes in the network
@@ -76,15 +98,26 @@ classdef hExportWLANPackets < handle
     methods
         function obj = hExportWLANPackets(wlanNodes, varargin)
 
-            % Check for number of input arguments
-            narginchk(1,3);
+            % Split the positional inputs from the streaming options
+            nvNames = ["Streaming" "BufferSize" "SnapLength" "SampleInterval"];
+            nvStart = find(cellfun(@(x) (isstring(x) || ischar(x)) && any(strcmpi(x, nvNames)), varargin), 1);
+            if isempty(nvStart)
+                nvStart = numel(varargin)+1;
+            end
+            streamingOptions = parseStreamingOptions(varargin(nvStart:end));
+            varargin = varargin(1:nvStart-1);
+
+            % Check for number of positional input arguments
+            if numel(varargin) > 2
+                error("hExportWLANPackets:TooManyInputs", "Too many positional input arguments.");
+            end
 
             % Set default values for non-mandatory inputs
             fileExtension = "pcap";
             enableRadiotap = false;
 
             % Check for non-mandatory inputs
-            switch nargin
+            switch numel(varargin)+1
                 % Two inputs provided:
                 % wlanNodes and fileExtension (OR)
                 % wlanNodes and enableRadiotap
@@ -122,7 +155,11 @@ classdef hExportWLANPackets < handle
 
             obj.WLANNodes = wlanNodes;
             obj.EnableRadiotap = enableRadiotap;
-            obj.PCAPObjList = wlanPCAPWriter.empty(0,numel(wlanNodes));
+            if streamingOptions.Streaming
+                obj.PCAPObjList = hBufferedPCAPWriter.empty(0,numel(wlanNodes));
+            else
+                obj.PCAPObjList = wlanPCAPWriter.empty(0,numel(wlanNodes));
+            end
             fileName = strings(1,numel(wlanNodes));
             for nodeIDx = 1:numel(wlanNodes)
                 if wlanNodes{nodeIDx}.MACFrameAbstraction
@@ -137,7 +174,14 @@ classdef hExportWLANPackets < handle
                     % Create a WLAN PCAP file writer object with the specified
                     % file name and extension by using the wlanPCAPWriter
                     % object.
-                    obj.PCAPObjList(nodeIDx) = wlanPCAPWriter('FileName', fileName(nodeIDx), 'FileExtension',fileExtension, 'RadiotapPresent', obj.EnableRadiotap);
+                    if streamingOptions.Streaming
+                        % Buffered writer with the same write interface
+                        obj.PCAPObjList(nodeIDx) = hBufferedPCAPWriter(fileName(nodeIDx), fileExtension, obj.EnableRadiotap, ...
+                            BufferSize=streamingOptions.BufferSize, SnapLength=streamingOptions.SnapLength, ...
+                            SampleInterval=streamingOptions.SampleInterval, MemoryMapSize=streamingOptions.MemoryMapSize);
+                    else
+                        obj.PCAPObjList(nodeIDx) = wlanPCAPWriter('FileName', fileName(nodeIDx), 'FileExtension',fileExtension, 'RadiotapPresent', obj.EnableRadiotap);
+                    end
                     addlistener(wlanNodes{nodeIDx}, 'MPDUDecoded', ...
                         @(src, eventData)packetWriterCallback(obj,obj.PCAPObjList(nodeIDx), src, eventData));
                     addlistener(wlanNodes{nodeIDx}, 'MPDUGenerated', ...
@@ -159,7 +203,8 @@ classdef hExportWLANPackets < handle
             %   from node. It also forms the radiotap bytes for the frames
             %   received at each node.
             %
-            %   PCAPOBJ is an object of type wlanPCAPWriter.
+            %   PCAPOBJ is an object of type wlanPCAPWriter or
+            %   hBufferedPCAPWriter.
             %
             %   NODEOBJ is an object of type wlanNode.
             %
@@ -772,3 +817,18 @@ classdef hExportWLANPackets < handle
         end
     end
 end
+
+function options = parseStreamingOptions(nvPairs)
+%parseStreamingOptions Parse the streaming name-value arguments of
+%hExportWLANPackets
+
+    parser = inputParser;
+    parser.FunctionName = "hExportWLANPackets";
+    addParameter(parser, "Streaming", false, @(x) validateattributes(x, "logical", {'scalar'}));
+    addParameter(parser, "BufferSize", 4*2^20, @(x) validateattributes(x, "numeric", {'scalar','integer','positive'}));
+    addParameter(parser, "SnapLength", 65535, @(x) validateattributes(x, "numeric", {'scalar','integer','positive'}));
+    addParameter(parser, "SampleInterval", 1, @(x) validateattributes(x, "numeric", {'scalar','integer','positive'}));
+    addParameter(parser, "MemoryMapSize", 0, @(x) validateattributes(x, "numeric", {'scalar','integer','nonnegative'}));
+    parse(parser, nvPairs{:});
+    options = parser.Results;
+end
@@ -0,0 +1,93 @@
+function perTable = hGeneratePHYAbstractionTable(fileName, options)
+    % PERTABLE = hGeneratePHYAbstractionTable(FILENAME) measures the packet
+    % error rate (PER) of the full PHY against the SINR for each MCS of the
+    % stage_lip device configuration (HT-Mixed, 20 MHz, 1500 byte packets)
+    % and saves the table to the MAT file FILENAME. The default file is
+    % "phyAbstractionTable.mat". simulate_simple(..., PHYAbstraction=
+    % "calibrated") loads this table, so it only has to be generated once
+    % per configuration.
+    %
+    % Each packet is generated with wlanWaveformGenerator, passed through an
+    % AWGN channel, and decoded with the same HT receiver chain as the full
+    % PHY (L-LTF noise estimate, HT-LTF channel estimate, HT-Data recovery).
+    % Timing is assumed to be perfect. The TGn Model-A channel used by the
+    % scenarios has a single static tap, so it only scales the SINR, which
+    % the system channel adds at run time from the path gains.
+    %
+    % PERTABLE is a structure with these fields:
+    %   MCS               - Vector of MCS values
+    %   SNR               - Vector of SINR values in dB
+    %   PER               - Matrix of PER values, one row per MCS
+    %   PSDULength        - PSDU length in bytes
+    %   ReferenceDuration - Duration of the PPDU for each MCS in seconds,
+    %                       used to scale the PER to other packet lengths
+    %   ChannelBandwidth  - Channel bandwidth in Hz
+    %   TransmissionFormat - Transmission format, "HT-Mixed"
+    %
+    % hGeneratePHYAbstractionTable(..., MCS=M, SNR=S, PSDULength=L,
+    % MaxPackets=N, MaxErrors=E) overrides the MCS values (default 0:7),
+    % the SINR points (default -2:0.5:30 dB), the PSDU length (default
+    % 1536 bytes: a 1500 byte MSDU with QoS data MAC header, LLC/SNAP
+    % header and FCS), and the number of packets and errors after which
+    % each point stops (defaults 1000 and 100).
+    arguments
+        fileName (1,1) string = "phyAbstractionTable.mat"
+        options.MCS (1,:) double {mustBeInteger, mustBeNonnegative} = 0:7
+        options.SNR (1,:) double = -2:0.5:30
+        options.PSDULength (1,1) double {mustBeInteger, mustBePositive} = 1536
+        options.MaxPackets (1,1) double {mustBeInteger, mustBePositive} = 1000
+        options.MaxErrors (1,1) double {mustBeInteger, mustBePositive} = 100
+        options.Seed (1,1) double = 1
+    end
+
+    rng(options.Seed, "combRecursive");
+    numMCS = numel(options.MCS);
+    numSNR = numel(options.SNR);
+
+    perTable = struct;
+    perTable.MCS = options.MCS;
+    perTable.SNR = options.SNR;
+    perTable.PER = ones(numMCS, numSNR);
+    perTable.PSDULength = options.PSDULength;
+    perTable.ReferenceDuration = zeros(1, numMCS);
+    perTable.ChannelBandwidth = 20e6;
+    perTable.TransmissionFormat = "HT-Mixed";
+
+    for m = 1:numMCS
+        cfg = wlanHTConfig(ChannelBandwidth="CBW20", MCS=options.MCS(m), PSDULength=options.PSDULength);
+        fs = wlanSampleRate(cfg);
+        ind = wlanFieldIndices(cfg);
+        perTable.ReferenceDuration(m) = double(ind.HTData(2))/fs;
+
+        for s = 1:numSNR
+            numErrors = 0;
+            numPackets = 0;
+            while numPackets < options.MaxPackets && numErrors < options.MaxErrors
+                psdu = randi([0 1], options.PSDULength*8, 1, 'int8');
+                tx = wlanWaveformGenerator(psdu, cfg);
+                rx = awgn(tx, options.SNR(s), 'measured');
+
+                % Noise estimate from the L-LTF, channel estimate from the
+                % HT-LTF, as in the full PHY receiver
+                lltfDemod = wlanLLTFDemodulate(rx(ind.LLTF(1):ind.LLTF(2),:), cfg);
+                nVarEst = wlanLLTFNoiseEstimate(lltfDemod);
+                htltfDemod = wlanHTLTFDemodulate(rx(ind.HTLTF(1):ind.HTLTF(2),:), cfg);
+                chanEst = wlanHTLTFChannelEstimate(htltfDemod, cfg);
+                rxPSDU = wlanHTDataRecover(rx(ind.HTData(1):ind.HTData(2),:), chanEst, nVarEst, cfg);
+
+                numErrors = numErrors + any(biterr(psdu, rxPSDU));
+                numPackets = numPackets + 1;
+            end
+            perTable.PER(m, s) = numErrors/numPackets;
+            fprintf('MCS %d, SINR %g dB: PER %g (%d packets)\n', options.MCS(m), options.SNR(s), perTable.PER(m, s), numPackets);
+
+            if numErrors == 0
+                % Error free from here on
+                perTable.PER(m, s:end) = 0;
+                break;
+            end
+        end
+    end
+
+    save(fileName, "perTable");
+end
@@ -0,0 +1,169 @@
+classdef hHeadlessMetrics < handle
+%hHeadlessMetrics Aggregated latency and throughput counters without plots
+%
+%   METRICS = hHeadlessMetrics(RXNODES) keeps the counters needed to report
+%   the average application packet latency at the wlanNode objects RXNODES.
+%   It replaces hVisualizePerformance for runs which only export metrics:
+%   no figure is created and no action is scheduled at the end of the
+%   simulation. One AppDataReceived listener is added to each of RXNODES.
+%   That event is the only source of the packet generation time, so
+%   latency cannot be computed without it. The listener adds to two
+%   counters and to a constant-memory hLatencyHistogram of the end-to-end
+%   latency of each flow (receiving node, source node).
+%
+%   METRICS = hHeadlessMetrics(RXNODES,TxNodes=TXNODES) also records the
+%   MAC queueing delay of each flow (transmitting node, receiving node) at
+%   the wlanNode objects TXNODES, from the TimeInQueue of the MPDUs
+%   reported by their TransmissionStatus events.
+%
+%   hHeadlessMetrics methods:
+%
+%   averagePacketLatency - Average application packet latency at a node
+%   latencyQuantiles     - End-to-end latency quantiles at a node
+%   queueingDelayQuantiles - MAC queueing delay quantiles at a node
+%   throughput           - MAC throughput of a node in Mbps
+
+    properties (Access=private)
+        %pNodeIDs IDs of the receiving nodes
+        pNodeIDs
+
+        %pLatencySum Aggregated application packet latency in seconds at
+        %each receiving node
+        pLatencySum
+
+        %pNumPackets Number of application packets received at each
+        %receiving node
+        pNumPackets
+
+        %pFlowKeys Key of each flow histogram as [type, node ID, peer node
+        %ID], where type is 1 for end-to-end latency and 2 for queueing delay
+        pFlowKeys = zeros(0,3)
+
+        %pFlowHistograms Histogram of each flow in pFlowKeys
+        pFlowHistograms = hLatencyHistogram.empty
+    end
+
+    properties (Constant, Access=private)
+        LatencyFlow = 1
+        QueueingFlow = 2
+    end
+
+    methods
+        function obj = hHeadlessMetrics(rxNodes,options)
+            arguments
+                rxNodes
+                options.TxNodes = []
+            end
+            numNodes = numel(rxNodes);
+            obj.pNodeIDs = [rxNodes.ID];
+            obj.pLatencySum = zeros(1,numNodes);
+            obj.pNumPackets = zeros(1,numNodes);
+            for idx = 1:numNodes
+                addlistener(rxNodes(idx),"AppDataReceived",@(~,eventData) countPacket(obj,idx,eventData.Data));
+            end
+            txNodes = options.TxNodes;
+            for idx = 1:numel(txNodes)
+                txNodeID = txNodes(idx).ID;
+                addlistener(txNodes(idx),"TransmissionStatus",@(~,eventData) recordQueueingDelay(obj,txNodeID,eventData.Data));
+            end
+        end
+
+        function latency = averagePacketLatency(obj,node)
+            %averagePacketLatency Return the average application packet
+            %latency in seconds at the receiving node
+            nodeIdx = obj.pNodeIDs==node.ID;
+            latency = obj.pLatencySum(nodeIdx)/obj.pNumPackets(nodeIdx);
+            if obj.pNumPackets(nodeIdx)==0
+                latency = 0;
+            end
+        end
+
+        function values = latencyQuantiles(obj,node,p,sourceNode)
+            %latencyQuantiles Return the end-to-end application packet
+            %latency quantiles in seconds at the receiving node
+            %
+            %   VALUES = latencyQuantiles(OBJ,NODE,P) returns the latency of
+            %   the packets received at NODE at the probabilities P, over
+            %   all the sources. VALUES = latencyQuantiles(...,SOURCENODE)
+            %   only uses the flow from SOURCENODE. NaN is returned if no
+            %   packet is received.
+            if nargin<4
+                sourceNode = [];
+            end
+            values = flowQuantiles(obj,obj.LatencyFlow,node,p,sourceNode);
+        end
+
+        function values = queueingDelayQuantiles(obj,node,p,destinationNode)
+            %queueingDelayQuantiles Return the MAC queueing delay quantiles
+            %in seconds at the transmitting node
+            %
+            %   VALUES = queueingDelayQuantiles(OBJ,NODE,P) returns the time
+            %   spent in the MAC queue of NODE by its MPDUs at the
+            %   probabilities P, over all the destinations. VALUES =
+            %   queueingDelayQuantiles(...,DESTINATIONNODE) only uses the
+            %   flow to DESTINATIONNODE. NODE must be one of the TxNodes.
+            if nargin<4
+                destinationNode = [];
+            end
+            values = flowQuantiles(obj,obj.QueueingFlow,node,p,destinationNode);
+        end
+
+        function throughput = throughput(~,node,simulationTime)
+            %throughput Return the MAC throughput of the node in Mbps, as
+            %computed by hVisualizePerformance
+            stats = statistics(node);
+            throughput = (sum([stats.MAC.TransmittedPayloadBytes])*8*1e-6)/simulationTime;
+        end
+    end
+
+    methods (Access=private)
+        function countPacket(obj,nodeIdx,notificationData)
+            %countPacket Aggregate the latency of a received application
+            %packet
+            latency = notificationData.CurrentTime-notificationData.PacketGenerationTime;
+            obj.pLatencySum(nodeIdx) = obj.pLatencySum(nodeIdx)+latency;
+            obj.pNumPackets(nodeIdx) = obj.pNumPackets(nodeIdx)+1;
+            record(flowHistogram(obj,obj.LatencyFlow,obj.pNodeIDs(nodeIdx),notificationData.SourceNodeID),latency);
+        end
+
+        function recordQueueingDelay(obj,txNodeID,notificationData)
+            %recordQueueingDelay Record the time spent in the MAC queue by
+            %the MPDUs which left the queue
+            if notificationData.FrameType~="QoS Data"
+                return
+            end
+            timeInQueue = notificationData.TimeInQueue(notificationData.MPDUDiscarded);
+            record(flowHistogram(obj,obj.QueueingFlow,txNodeID,notificationData.ReceiverNodeID),timeInQueue);
+        end
+
+        function histogram = flowHistogram(obj,type,nodeID,peerID)
+            %flowHistogram Return the histogram of a flow, created on first
+            %use
+            flowIdx = find(obj.pFlowKeys(:,1)==type & obj.pFlowKeys(:,2)==nodeID & obj.pFlowKeys(:,3)==peerID,1);
+            if isempty(flowIdx)
+                obj.pFlowKeys(end+1,:) = [type nodeID peerID];
+                obj.pFlowHistograms(end+1) = hLatencyHistogram;
+                flowIdx = numel(obj.pFlowHistograms);
+            end
+            histogram = obj.pFlowHistograms(flowIdx);
+        end
+
+        function values = flowQuantiles(obj,type,node,p,peerNode)
+            %flowQuantiles Return the quantiles of the flows of a node,
+            %merged over the peers when PEERNODE is empty
+            flowIdx = find(obj.pFlowKeys(:,1)==type & obj.pFlowKeys(:,2)==node.ID);
+            if ~isempty(peerNode)
+                flowIdx = flowIdx(obj.pFlowKeys(flowIdx,3)==peerNode.ID);
+            end
+            values = nan(size(p));
+            if isempty(flowIdx)
+                return
+            end
+            histogram = obj.pFlowHistograms(flowIdx(1));
+            if ~isscalar(flowIdx)
+                histogram = merge(obj.pFlowHistograms(flowIdx));
+            end
+            values = quantile(histogram,p);
+        end
+    end
+end
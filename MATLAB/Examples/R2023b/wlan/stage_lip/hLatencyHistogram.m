@@ -0,0 +1,168 @@
+classdef hLatencyHistogram < handle
+%hLatencyHistogram Constant-memory latency histogram with quantiles
+%
+%   HIST = hLatencyHistogram() creates a log-linear (HDR-style) histogram of
+%   latencies in seconds. Each power-of-two range of values above
+%   LowestValue is split into SubBucketCount linear buckets, so a quantile
+%   is reported within a relative error of 1/SubBucketCount, whatever the
+%   number of recorded values. Values below LowestValue fall in the first
+%   bucket and values above HighestValue in the last one.
+%
+%   HIST = hLatencyHistogram(LowestValue=L, HighestValue=H,
+%   SubBucketCount=N) sets the lowest and highest tracked values in seconds
+%   (defaults 1e-6 and 1e3) and the number of buckets per power of two
+%   (default 64).
+%
+%   hLatencyHistogram properties (read-only):
+%
+%   Count - Number of recorded values
+%   Sum   - Sum of the recorded values in seconds
+%   Min   - Minimum recorded value in seconds
+%   Max   - Maximum recorded value in seconds
+%
+%   hLatencyHistogram methods:
+%
+%   record   - Record one or more values
+%   quantile - Return the values at the given probabilities
+%   mean     - Return the mean of the recorded values
+%   merge    - Combine histograms with the same buckets
+
+    properties (SetAccess=private)
+        %Count Number of recorded values
+        Count = 0
+
+        %Sum Sum of the recorded values in seconds
+        Sum = 0
+
+        %Min Minimum recorded value in seconds
+        Min = Inf
+
+        %Max Maximum recorded value in seconds
+        Max = -Inf
+
+        %LowestValue Lowest tracked value in seconds
+        LowestValue = 1e-6
+
+        %HighestValue Highest tracked value in seconds
+        HighestValue = 1e3
+
+        %SubBucketCount Number of linear buckets per power of two
+        SubBucketCount = 64
+    end
+
+    properties (Access=private)
+        %pCounts Number of values in each bucket
+        pCounts
+
+        %pNumBuckets Number of buckets
+        pNumBuckets
+    end
+
+    methods
+        function obj = hLatencyHistogram(options)
+            arguments
+                options.LowestValue (1,1) double {mustBePositive} = 1e-6
+                options.HighestValue (1,1) double {mustBePositive} = 1e3
+                options.SubBucketCount (1,1) double {mustBeInteger, mustBePositive} = 64
+            end
+            obj.LowestValue = options.LowestValue;
+            obj.HighestValue = options.HighestValue;
+            obj.SubBucketCount = options.SubBucketCount;
+            numMagnitudes = ceil(log2(obj.HighestValue/obj.LowestValue));
+            obj.pNumBuckets = numMagnitudes*obj.SubBucketCount+1;
+            obj.pCounts = zeros(1,obj.pNumBuckets);
+        end
+
+        function record(obj,values)
+            %record Record one or more values in seconds
+
+            values = values(:)';
+            if isempty(values)
+                return
+            end
+            obj.Count = obj.Count+numel(values);
+            obj.Sum = obj.Sum+sum(values);
+            obj.Min = min(obj.Min,min(values));
+            obj.Max = max(obj.Max,max(values));
+            bucketIdx = bucketIndex(obj,values);
+            if isscalar(bucketIdx)
+                obj.pCounts(bucketIdx) = obj.pCounts(bucketIdx)+1;
+            else
+                obj.pCounts = obj.pCounts+accumarray(bucketIdx',1,[obj.pNumBuckets 1])';
+            end
+        end
+
+        function values = quantile(obj,p)
+            %quantile Return the values in seconds at the probabilities P
+            %
+            %   The value of a bucket is its midpoint, clamped to the
+            %   recorded minimum and maximum. NaN is returned if no value is
+            %   recorded.
+
+            values = nan(size(p));
+            if obj.Count==0
+                return
+            end
+            cumCounts = cumsum(obj.pCounts);
+            for idx = 1:numel(p)
+                target = max(ceil(p(idx)*obj.Count),1);
+                bucketIdx = find(cumCounts>=target,1);
+                [lower,upper] = bucketBounds(obj,bucketIdx);
+                values(idx) = min(max((lower+upper)/2,obj.Min),obj.Max);
+            end
+        end
+
+        function value = mean(obj)
+            %mean Return the mean of the recorded values in seconds
+            value = obj.Sum/obj.Count;
+        end
+
+        function merged = merge(histograms)
+            %merge Return a new histogram with the values of all the
+            %histograms in the array HISTOGRAMS, which must have the same
+            %buckets
+            first = histograms(1);
+            merged = hLatencyHistogram(LowestValue=first.LowestValue, ...
+                HighestValue=first.HighestValue,SubBucketCount=first.SubBucketCount);
+            for idx = 1:numel(histograms)
+                h = histograms(idx);
+                assert(h.pNumBuckets==merged.pNumBuckets && h.LowestValue==merged.LowestValue, ...
+                    'Histograms must have the same buckets')
+                merged.pCounts = merged.pCounts+h.pCounts;
+                merged.Count = merged.Count+h.Count;
+                merged.Sum = merged.Sum+h.Sum;
+                merged.Min = min(merged.Min,h.Min);
+                merged.Max = max(merged.Max,h.Max);
+            end
+        end
+    end
+
+    methods (Access=private)
+        function bucketIdx = bucketIndex(obj,values)
+            %bucketIndex Return the bucket of each value. Bucket 1 holds the
+            %values below LowestValue.
+
+            scaled = values/obj.LowestValue;
+            magnitude = floor(log2(max(scaled,1)));
+            subBucket = floor((scaled./2.^magnitude-1)*obj.SubBucketCount);
+            bucketIdx = magnitude*obj.SubBucketCount+subBucket+2;
+            bucketIdx(scaled<1) = 1;
+            bucketIdx = min(bucketIdx,obj.pNumBuckets);
+        end
+
+        function [lower,upper] = bucketBounds(obj,bucketIdx)
+            %bucketBounds Return the range of values of a bucket in seconds
+
+            if bucketIdx==1
+                lower = 0;
+                upper = obj.LowestValue;
+                return
+            end
+            magnitude = floor((bucketIdx-2)/obj.SubBucketCount);
+            subBucket = bucketIdx-2-magnitude*obj.SubBucketCount;
+            width = 2^magnitude/obj.SubBucketCount;
+            lower = obj.LowestValue*(2^magnitude+subBucket*width);
+            upper = lower+obj.LowestValue*width;
+        end
+    end
+end
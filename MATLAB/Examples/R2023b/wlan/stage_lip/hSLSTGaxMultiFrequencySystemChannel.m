@@ -20,11 +20,32 @@ classdef hSLSTGaxMultiFrequencySystemChannel < handle
 % sets the path loss model to 'free-space', 'residential', or 'enterprise'.
 % The default is 'free-space').
 %
+% CHAN = hSLSTGaxMultiFrequencySystemChannel(...,PERTable=table) applies
+% the PER-vs-SINR table generated by hGeneratePHYAbstractionTable to the
+% packets of abstracted PHY nodes. A packet is dropped at a receiver, by
+% setting its power to -Inf dBm, with the PER of the transmitter MCS at
+% the SINR of the link. The table is measured for one transmission format
+% and channel bandwidth, which all transmitters must use. Use it with the
+% "tgax-mac-calibration" PHY
+% abstraction, which does not draw packet errors from the SINR itself.
+% The SINR includes the path loss, shadow fading and path gains of the
+% link, but not the interference.
+%
+% CHAN = hSLSTGaxMultiFrequencySystemChannel(...,ReceiveSensitivity=val)
+% drops the packets whose power after path loss and shadow fading is below
+% val dBm, before the fading channel is applied to their waveform. The
+% default is -Inf, which keeps all packets.
+%
+% The path loss between all pairs of nodes is evaluated once when the
+% object is created and reused while the nodes do not move.
+%
 %   hSLSTGaxMultiFrequencySystemChannel properties:
 %
 %   Channels   - Array of system channels; one channel per frequency.
 %   ChannelFcn - Function handle to channel for all nodes and links in
 %                the simulation
+%   PathLossFcn - Function handle to the path loss minus shadow fading of
+%                 a link, for the receive power threshold of the simulator
 %
 %   hSLSTGaxMultiFrequencySystemChannel methods:
 %
@@ -43,11 +64,23 @@ classdef hSLSTGaxMultiFrequencySystemChannel < handle
         %ChannelFcn Function handle to channel for all nodes and links in
         %the simulation
         ChannelFcn;
+        %PathLossFcn Function handle to the path loss minus shadow fading of
+        %a link in dB, NaN if it may change from packet to packet. Pass it
+        %to addChannelModel with ChannelFcn so that the simulator can skip
+        %out-of-range receivers without calling the channel.
+        PathLossFcn;
     end
 
     properties (Access=private)
         UseFullPHY = false;
         NodeIDs;
+        NodeLUT; % LUT index for each node ID, 0 for unknown node IDs
+        ChannelFrequencies; % Center frequency of each system channel
+        PERTable = []; % PER-vs-SINR table, empty if not used
+        NodeMCS; % MCS of each node, by LUT index
+        NodeFormat; % Transmission format of each node, by LUT index
+        NodeBandwidth; % Channel bandwidth in Hz of each node, by LUT index
+        NodeNoiseFloor; % Thermal noise power in dBm of each node, by LUT index
     end
 
     methods
@@ -82,9 +115,17 @@ classdef hSLSTGaxMultiFrequencySystemChannel < handle
                     nvpairStart = 2;
                 end
             end
+            % The PER table is used here, the remaining name-value pairs
+            % are passed to the system channels
+            perTableIdx = find(cellfun(@(x) (ischar(x) || isstring(x)) && strcmpi(x,'PERTable'), varargin(nvpairStart:end)),1) + nvpairStart - 1;
+            if ~isempty(perTableIdx)
+                obj.PERTable = varargin{perTableIdx+1};
+                varargin(perTableIdx:perTableIdx+1) = [];
+            end
             % Select type of channel model depending on PHY abstraction
             % used
             obj.UseFullPHY = nodes(1).PHYAbstractionMethod == "none";
+            assert(isempty(obj.PERTable) || ~obj.UseFullPHY,'The PER table applies only to abstracted PHY nodes')
 
             nodeFreqs = [];
             nodeBWs = [];
@@ -133,6 +174,21 @@ classdef hSLSTGaxMultiFrequencySystemChannel < handle
 
             nodeIDs = [nodes.ID];
             obj.NodeIDs = nodeIDs(:);
+            obj.NodeLUT = zeros(max(nodeIDs),1);
+            obj.NodeLUT(nodeIDs) = 1:numNodes;
+
+            % MCS, format, bandwidth and thermal noise floor of the first
+            % device of each node, used to look up the PER table
+            obj.NodeMCS = zeros(numNodes,1);
+            obj.NodeFormat = strings(numNodes,1);
+            obj.NodeBandwidth = zeros(numNodes,1);
+            obj.NodeNoiseFloor = zeros(numNodes,1);
+            for n = 1:numNodes
+                obj.NodeMCS(n) = nodes(n).DeviceConfig(1).MCS;
+                obj.NodeFormat(n) = nodes(n).DeviceConfig(1).TransmissionFormat;
+                obj.NodeBandwidth(n) = nodes(n).DeviceConfig(1).ChannelBandwidth;
+                obj.NodeNoiseFloor(n) = -174+10*log10(nodes(n).DeviceConfig(1).ChannelBandwidth)+nodes(n).DeviceConfig(1).NoiseFigure;
+            end
 
             % Create a channel manager for each band
             if obj.UseFullPHY
@@ -158,8 +214,18 @@ classdef hSLSTGaxMultiFrequencySystemChannel < handle
                 end
             end
 
+            obj.ChannelFrequencies = [obj.Channels.CenterFrequency];
+
+            % Evaluate the path loss of the static topology in one batch
+            % per channel, by LUT index
+            nodePositions = reshape([nodes.Position],3,[])';
+            for i = 1:numFreqs
+                precomputePathLoss(obj.Channels(i),nodePositions);
+            end
+
             % Function handle to return impaired signal
             obj.ChannelFcn = @(rxInfo,signal)impairSignal(obj,signal,rxInfo);
+            obj.PathLossFcn = @(rxInfo,signal)largeScaleLoss(obj,signal,rxInfo);
         end
     end
 
@@ -175,15 +241,24 @@ classdef hSLSTGaxMultiFrequencySystemChannel < handle
             sig.TransmitterID = nodeid2lutind(obj,sig.TransmitterID);
             rxInfo.ID = nodeid2lutind(obj,rxInfo.ID);
 
-            channel = getChannelForSignalFrequency(obj.Channels,sig);
+            channel = getChannelForSignalFrequency(obj.Channels,obj.ChannelFrequencies,sig);
 
             % Model path loss
-            sig = pathLoss(obj,channel,sig,rxInfo);
-            disp(['Puissance après pathloss : ', num2str(sig.Power), ' dBm']);
+            [sig,pl] = pathLoss(obj,channel,sig,rxInfo);
 
             % Model shadow fading
-            sig = shadowFading(obj,channel,sig,rxInfo);
-            disp(['Puissance après shadowfading : ', num2str(sig.Power), ' dBm']);
+            [sig,l] = shadowFading(obj,channel,sig,rxInfo);
+
+            % Drop the packets below the receive sensitivity before any
+            % waveform processing
+            if sig.Power<channel.ReceiveSensitivity
+                sig = [];
+                return
+            end
+            if obj.UseFullPHY
+                % Scale signal by path loss and shadow fading
+                sig.Data = sig.Data*db2mag(l-pl);
+            end
 
 
             % Model frequency-selective fading
@@ -191,18 +266,34 @@ classdef hSLSTGaxMultiFrequencySystemChannel < handle
                 sig = applyChannelToSignalStructure(channel,sig,rxInfo);
             else
                 sig.Metadata.Channel = getChannelStatistics(channel,sig,rxInfo);
+                if ~isempty(obj.PERTable)
+                    sig = packetError(obj,sig,rxInfo);
+                end
             end
 
-            disp(['Puissance après freq-selective fading (full phy = true) : ', num2str(sig.Power), ' dBm']);
-
-
             % Restore original transmitter node ID
             sig.TransmitterID = nodeTxID;
         end
 
-        function sig = pathLoss(obj, channel, sig, rxInfo)
-            %pathLoss Apply path loss to the packet and update relevant fields
-            %of the output data.
+        function l = largeScaleLoss(obj,sig,rxInfo)
+            %largeScaleLoss Return the path loss minus the shadow fading of
+            %the link in dB, or NaN if it is not fixed for the link
+
+            l = NaN;
+            sig.TransmitterID = nodeid2lutind(obj,sig.TransmitterID);
+            rxInfo.ID = nodeid2lutind(obj,rxInfo.ID);
+            if isempty(sig.TransmitterID) || isempty(rxInfo.ID)
+                return
+            end
+            channel = getChannelForSignalFrequency(obj.Channels,obj.ChannelFrequencies,sig);
+            if ~isempty(channel)
+                l = getLargeScaleLoss(channel,sig,rxInfo);
+            end
+        end
+
+        function [sig,pl] = pathLoss(~, channel, sig, rxInfo)
+            %pathLoss Apply path loss to the power of the packet. The
+            %waveform is scaled by the caller.
 
             pl = getPathLoss(channel,sig,rxInfo); % dB
 
@@ -213,32 +304,58 @@ classdef hSLSTGaxMultiFrequencySystemChannel < handle
             sig.Power = sig.Power - pl;
 
             %%%disp(['Puissance du signal apres path-loss : ', num2str(sig.Power), ' dB'])
-
-            if obj.UseFullPHY
-                % Scale signal by path loss
-                sig.Data = sig.Data*db2mag(-pl);
-            end
         end
 
-        function sig = shadowFading(obj, channel, sig, rxInfo)
-            %shadowFading Apply log-normal shadow fading to the packet and
-            %update relevant fields of the output data.
+        function [sig,l] = shadowFading(~, channel, sig, rxInfo)
+            %shadowFading Apply log-normal shadow fading to the power of the
+            %packet. The waveform is scaled by the caller.
 
             txIdx = sig.TransmitterID;
             rxIdx = rxInfo.ID;
             l = getShadowFading(channel,txIdx,rxIdx); % dB
             % Apply shadow fading to the power of the packet
             sig.Power = sig.Power + l; % power in dBm
+        end
 
-            if obj.UseFullPHY
-                % Scale signal by shadow fading
-                sig.Data = sig.Data*db2mag(l);
+        function sig = packetError(obj, sig, rxInfo)
+            %packetError Drop the packet at the receiver with the PER of the
+            %table at the SINR of the link
+
+            perTable = obj.PERTable;
+            % The table only holds the curves of its format and bandwidth;
+            % tables without a format field are HT-Mixed
+            tableFormat = "HT-Mixed";
+            if isfield(perTable,'TransmissionFormat')
+                tableFormat = perTable.TransmissionFormat;
+            end
+            assert(obj.NodeFormat(sig.TransmitterID)==tableFormat && obj.NodeBandwidth(sig.TransmitterID)==perTable.ChannelBandwidth, ...
+                'The PER table is for %s at %g MHz, the transmitter uses %s at %g MHz', tableFormat, perTable.ChannelBandwidth/1e6, ...
+                obj.NodeFormat(sig.TransmitterID), obj.NodeBandwidth(sig.TransmitterID)/1e6)
+            mcsIdx = find(perTable.MCS==obj.NodeMCS(sig.TransmitterID),1);
+            if isempty(mcsIdx)
+                return
+            end
+
+            % Average gain of the paths over the antenna pairs
+            pathGains = sig.Metadata.Channel.PathGains;
+            gain = sum(abs(pathGains).^2,'all')/(size(pathGains,3)*size(pathGains,4));
+            sinr = sig.Power+10*log10(gain)-obj.NodeNoiseFloor(rxInfo.ID);
+
+            % PER of the reference PSDU, scaled to the packet duration
+            sinr = min(max(sinr,perTable.SNR(1)),perTable.SNR(end));
+            per = interp1(perTable.SNR,perTable.PER(mcsIdx,:),sinr);
+            per = 1-(1-per)^(sig.Duration/perTable.ReferenceDuration(mcsIdx));
+            if rand<per
+                sig.Power = -Inf;
             end
         end
 
         function lutInd = nodeid2lutind(obj, nodeID)
             % Return LUT index for node ID
-            lutInd = find(nodeID==obj.NodeIDs);
+            lutInd = [];
+            if nodeID>=1 && nodeID<=numel(obj.NodeLUT) && obj.NodeLUT(nodeID)>0
+                lutInd = obj.NodeLUT(nodeID);
+            end
         end
 
         function nodeID = lutind2nodeid(obj, lutInd)
@@ -248,13 +365,14 @@ classdef hSLSTGaxMultiFrequencySystemChannel < handle
     end
 end
 
-function channel = getChannelForSignalFrequency(channels,sig)
+function channel = getChannelForSignalFrequency(channels,channelFrequencies,sig)
     %getChannelForSignalFrequency Returns the appropriate channel manager
     %object
     %
-    % CHANNEL = getChannelForSignalFrequency(CHANNELS, SIG) returns the channel
-    % manager object for the matching center frequency
+    % CHANNEL = getChannelForSignalFrequency(CHANNELS, CHANNELFREQUENCIES, SIG)
+    % returns the channel manager object for the matching center frequency.
+    % CHANNELFREQUENCIES contains the center frequency of each channel.
 
-    channelIdx = sig.CenterFrequency==[channels.CenterFrequency];
+    channelIdx = sig.CenterFrequency==channelFrequencies;
     channel = channels(channelIdx);
 end
\ No newline at end of file
@@ -30,6 +30,8 @@ classdef hSLSTGaxSystemChannel < hSLSTGaxSystemChannelBase
 
     properties (Access=private)
         ChannelFilter;
+        SharedFilterKeys; % [filter pool index, transmit antennas, receive antennas] of each shared filter
+        SharedFilters; % Channel filters shared by the links with the same key
     end
 
     methods
@@ -46,6 +48,8 @@ classdef hSLSTGaxSystemChannel < hSLSTGaxSystemChannelBase
 
         function initialize(obj)
             obj.ChannelFilter = cell(obj.NumChannels,2);
+            obj.SharedFilterKeys = zeros(0,3);
+            obj.SharedFilters = {};
         end
 
         function [sig,pg,chanInfo] = applyChannelToSignalStructure(obj,sig,rxInfo)
@@ -54,7 +58,9 @@ classdef hSLSTGaxSystemChannel < hSLSTGaxSystemChannelBase
             % between two nodes. The receiver is specified by the structure
             % RXINFO.
 
-            chanFilt = getChannelFilter(obj,sig.TransmitterID,rxInfo.ID);
+            % The filter is reset for each packet, so the links with the
+            % same path delays and antennas share one filter
+            chanFilt = getSharedChannelFilter(obj,sig.TransmitterID,rxInfo.ID);
             chanInfo = info(chanFilt);
 
             % Add trailing zeros to allow for channel delay
@@ -69,7 +75,7 @@ classdef hSLSTGaxSystemChannel < hSLSTGaxSystemChannelBase
 
             % Reset filter as we assume one packet filtered at a time and
             % we are jumping ahead in time and we don't want any internal
-            % state
+            % state, also from another link
             reset(chanFilt);
 
             % Filter waveform
@@ -132,5 +138,28 @@ classdef hSLSTGaxSystemChannel < hSLSTGaxSystemChannelBase
                 chanFilt = obj.ChannelFilter{idx,1};
             end
         end
+
+        function chanFilt = getSharedChannelFilter(obj,txIdx,rxIdx)
+            % CHANFILT = getSharedChannelFilter(OBJ,TXIDX,RXIDX) returns the
+            % channel filter shared by all the links with the path delays
+            % and the number of antennas of the link between node index
+            % TXIDX and RXIDX. The caller must reset it before use.
+
+            [idx,switched] = sub2chanInd(obj,txIdx,rxIdx);
+            numAnts = [obj.Links(idx).Channel.NumTransmitAntennas obj.Links(idx).Channel.NumReceiveAntennas];
+            if switched
+                numAnts = fliplr(numAnts);
+            end
+            key = [filterPoolIndex(obj,idx) numAnts];
+
+            filterIdx = find(all(obj.SharedFilterKeys==key,2),1);
+            if isempty(filterIdx)
+                fs = obj.Links(idx).SampleRate; % Sample rate of each channel
+                obj.SharedFilters{end+1} = comm.ChannelFilter('PathDelays',double(getPathDelays(obj,idx)),'SampleRate',fs,'NormalizeChannelOutputs',obj.Links(idx).Channel.NormalizeChannelOutputs);
+                obj.SharedFilterKeys(end+1,:) = key;
+                filterIdx = numel(obj.SharedFilters);
+            end
+            chanFilt = obj.SharedFilters{filterIdx};
+        end
     end
 end
\ No newline at end of file
@@ -12,6 +12,11 @@ classdef hSLSTGaxSystemChannelBase < handle
 %   property must be set. The channel configuration is assumed to be the
 %   same between all nodes.
 %
+%   Each link keeps its own fading channel object and path gains. The path
+%   delays and path filter coefficients are computed once and shared by
+%   all the links with the same channel class, delay profile, sample rate
+%   and output normalization.
+%
 %   hSLSTGaxSystemChannelBase properties:
 %
 %   Links           - Array of structures containing the channel for
@@ -35,6 +40,10 @@ classdef hSLSTGaxSystemChannelBase < handle
 %                                   in dB
 %   PathLossModel    - Path loss model
 %   PathLossModelFcn - Custom path loss model function handle
+%   VectorizedPathLossModelFcn - Custom path loss model only depends on
+%                                positions and accepts many receivers
+%   ReceiveSensitivity - Receive power in dBm below which packets are
+%                        dropped before fading
 %
 %   hSLSTGaxSystemChannelBase methods:
 %
@@ -42,6 +51,10 @@ classdef hSLSTGaxSystemChannelBase < handle
 %                          nodes
 %   reset                - calculate channel sampling rates and random
 %                          shadow fading for all links
+%   getPathLoss          - path loss between a transmitter and a receiver
+%   getPathLosses        - path loss to many receivers in one call
+%   precomputePathLoss   - path loss between all pairs of static nodes
+%   getLargeScaleLoss    - path loss minus shadow fading of a static link
 
 %   Copyright 2022-2023 The MathWorks, Inc.
 
@@ -52,16 +65,23 @@ classdef hSLSTGaxSystemChannelBase < handle
         PathFilters; % Path filters for all channels
         PathDelays;  % Path delays for all channels
         ChanIndLUT;  % Array used to map channel index
+        ChanIndMatrix; % Channel index for each pair of node indices
 
         Channels;    % Object for each channel
         PathTimes;
         LastPathTime;
         SampleTimeOffset;
         PathTimeOffset;
+        PathGainsTimeInvariant; % Flag per channel, true when the stored path gains do not change over time
+        PathLossCache; % Path loss and node positions for each pair of node indices
+        FilterPoolKeys = strings(0,1); % Delay profile signature of each pooled path filter set
+        FilterPool = struct('PathDelays',{},'PathFilters',{}); % Path delays and filters shared by the links with the same signature
+        LinkFilterPoolIndex; % Index in FilterPool of each channel, 0 if not looked up yet
     end
 
     properties (Access=protected)
         NumChannels;
+        NumNodes;
     end
 
     properties
@@ -86,6 +106,22 @@ classdef hSLSTGaxSystemChannelBase < handle
         %    rxInfo is a structure containing information about the
         %    receiver.
         PathLossModelFcn;
+        %VectorizedPathLossModelFcn Custom path loss model only depends on
+        %positions and accepts many receivers
+        %    Set to true when PathLossModelFcn only depends on
+        %    sig.TransmitterPosition and rxInfo.Position, and returns an
+        %    N-by-1 vector of path losses when rxInfo.Position is N-by-3.
+        %    The custom path loss is then cached and evaluated in batches
+        %    like the built-in models. The default is false.
+        VectorizedPathLossModelFcn (1,1) logical = false;
+        %ReceiveSensitivity Receive power in dBm below which packets are
+        %dropped before fading
+        %    A packet whose power after path loss and shadow fading is
+        %    below this value is dropped at the receiver before the fading
+        %    channel is applied to its waveform. Dropped packets do not
+        %    contribute to interference, so keep a margin below the noise
+        %    floor. The default is -Inf, which keeps all packets.
+        ReceiveSensitivity = -Inf;
     end
 
     properties (Constant, Hidden=true)
@@ -129,6 +165,17 @@ classdef hSLSTGaxSystemChannelBase < handle
             % transmitter index will always be lower than the receiver
             % index.
             obj.ChanIndLUT = nchoosek(1:numNodes,2);
+            obj.NumNodes = numNodes;
+
+            % Dense lookup of the channel index for a pair of node indices,
+            % in either direction. Zero indicates no channel.
+            obj.ChanIndMatrix = zeros(numNodes,numNodes);
+            obj.ChanIndMatrix(sub2ind([numNodes numNodes],obj.ChanIndLUT(:,1),obj.ChanIndLUT(:,2))) = 1:height(obj.ChanIndLUT);
+            obj.ChanIndMatrix(sub2ind([numNodes numNodes],obj.ChanIndLUT(:,2),obj.ChanIndLUT(:,1))) = 1:height(obj.ChanIndLUT);
+
+            % Path loss cache, one row per pair of node indices containing
+            % [pathLoss txPosition rxPosition]. NaN rows are empty.
+            obj.PathLossCache = nan(numNodes*numNodes,7);
 
             % Allocate arrays to store channels generated
             obj.NumChannels = height(obj.ChanIndLUT);
@@ -137,6 +184,7 @@ classdef hSLSTGaxSystemChannelBase < handle
             obj.PathDelays = cell(obj.NumChannels,1);
             obj.PathFilters = cell(obj.NumChannels,1);
             obj.PathGains = cell(obj.NumChannels,1);
+            obj.LinkFilterPoolIndex = zeros(1,obj.NumChannels);
             obj.CenterFrequency = chan.CarrierFrequency;
 
             % Generate channels
@@ -189,9 +237,11 @@ classdef hSLSTGaxSystemChannelBase < handle
                 obj.PathTimes{ichan} = [];
                 obj.PathDelays{ichan} = [];
                 obj.PathFilters{ichan} = [];
+                obj.LinkFilterPoolIndex(ichan) = 0; % The channel properties may have been edited
                 obj.SampleTimeOffset(ichan) = 0;
                 obj.LastPathTime(ichan) = -1;
                 obj.PathTimeOffset(ichan) = 0;
+                obj.PathGainsTimeInvariant(ichan) = false;
 
                 if isempty(obj.Channels) || isempty(obj.Channels{ichan})
                     % No channel exists
@@ -266,9 +316,9 @@ classdef hSLSTGaxSystemChannelBase < handle
             idx = channelIndex(obj,varargin{:});
 
             if isempty(obj.PathDelays{idx})
-                % Get path delays and filters if they do not already exist
-                chanInfo = info(obj.Channels{idx});
-                obj.PathDelays{idx} = chanInfo.PathDelays;
+                % Reference the path delays shared by the links with the
+                % same delay profile
+                obj.PathDelays{idx} = obj.FilterPool(filterPoolIndex(obj,idx)).PathDelays;
             end
             pd = obj.PathDelays{idx};
         end
@@ -286,17 +336,13 @@ classdef hSLSTGaxSystemChannelBase < handle
             idx = channelIndex(obj,varargin{:});
 
             if isempty(obj.PathFilters{idx})
-                % Get path delays and filters if they do not already exist
-                chanInfo = info(obj.Channels{idx});
-                obj.PathDelays{idx} = chanInfo.PathDelays;
-
-                % Channel filter in obj.Channel may be configured for
-                % lowest sample rate, so calculate path filters externally
-                channelFilter = comm.ChannelFilter( ...
-                    'SampleRate', obj.Links(idx).SampleRate, ...
-                    'PathDelays', double(getPathDelays(obj,idx)), ...
-                    'NormalizeChannelOutputs', obj.Channels{idx}.NormalizeChannelOutputs);
-                obj.PathFilters{idx} = info(channelFilter).ChannelFilterCoefficients;
+                % Reference the path delays and filters shared by the links
+                % with the same delay profile. All the links share the
+                % same filter coefficients, only the path gains (fading)
+                % are per link.
+                poolIdx = filterPoolIndex(obj,idx);
+                obj.PathDelays{idx} = obj.FilterPool(poolIdx).PathDelays;
+                obj.PathFilters{idx} = obj.FilterPool(poolIdx).PathFilters;
             end
             pf = obj.PathFilters{idx};
             pd = obj.PathDelays{idx};
@@ -394,6 +440,10 @@ classdef hSLSTGaxSystemChannelBase < handle
                 end
                 obj.LastPathTime(idx) = lastPathTime;
                 obj.PathTimeOffset(idx) = pathTimeOffset;
+
+                % Static links, such as those with EnvironmentalSpeed=0,
+                % produce the same path gains at all stored times
+                obj.PathGainsTimeInvariant(idx) = all(obj.PathGains{idx} == obj.PathGains{idx}(1,:,:,:),'all');
             end
 
             % Channel path gains are generated (and stored) for one
@@ -420,7 +470,13 @@ classdef hSLSTGaxSystemChannelBase < handle
                 otherwise % linear
                     % Interpolate path gains over sample times
                     st = sampleTimes';
-                    pg = double(interp1(obj.PathTimes{idx},pgUse,sampleTimes'));
+                    if obj.PathGainsTimeInvariant(idx)
+                        % Nothing to interpolate when the path gains do not
+                        % change over time
+                        pg = repmat(double(pgUse(1,:,:,:)),numel(sampleTimes),1);
+                    else
+                        pg = double(interp1(obj.PathTimes{idx},pgUse,sampleTimes'));
+                    end
             end
         end
 
@@ -438,31 +494,186 @@ classdef hSLSTGaxSystemChannelBase < handle
             %pathLoss Calculates path loss based on the signal and receiver
             %information
 
-            d = norm(sig.TransmitterPosition - rxInfo.Position);
+            % The built-in models only depend on the node positions, so
+            % reuse the path loss of a node pair until either node moves.
+            % The custom model may depend on any field of the signal.
+            cacheIdx = pathLossCacheIndex(obj, sig, rxInfo);
+            if cacheIdx>0 && isequal(obj.PathLossCache(cacheIdx,2:7), [sig.TransmitterPosition(:)' rxInfo.Position(:)'])
+                pl = obj.PathLossCache(cacheIdx,1);
+            else
+                d = norm(sig.TransmitterPosition - rxInfo.Position);
+
+                switch obj.PathLossModel
+                    case 'free-space'
+                        pl = freeSpacePathLoss(obj, d);
+                    case 'residential'
+                        pl = tgaxResidentialPathLoss(obj, d);
+                    case 'enterprise'
+                        pl = tgaxEnterprisePathLoss(obj, d);
+                    case 'custom'
+                        pl = obj.PathLossModelFcn(sig,rxInfo);
+                end
 
-            switch obj.PathLossModel
-                case 'free-space'
-                    pl = freeSpacePathLoss(obj, d);
-                case 'residential'
-                    pl = tgaxResidentialPathLoss(obj, d);
-                case 'enterprise'
-                    pl = tgaxEnterprisePathLoss(obj, d);
-                case 'custom'
-                    pl = obj.PathLossModelFcn(sig,rxInfo);
+                if cacheIdx>0
+                    obj.PathLossCache(cacheIdx,:) = [pl sig.TransmitterPosition(:)' rxInfo.Position(:)'];
+                end
+            end
+        end
+
+        function pl = getPathLosses(obj, sig, rxInfo)
+            % PL = getPathLosses(OBJ,SIG,RXINFO) returns the path loss in
+            % dB from the transmitter of SIG to N receivers in one call.
+            % RXINFO.ID is a vector of N receiver node indices and
+            % RXINFO.Position is an N-by-3 matrix of their positions. PL is
+            % an N-by-1 vector. Cached pairs are looked up and the others
+            % are evaluated with one vectorized call to the model, unless
+            % the custom model is not vectorized.
+
+            rxIDs = rxInfo.ID(:);
+            rxPositions = rxInfo.Position;
+            numRx = numel(rxIDs);
+            txPosition = sig.TransmitterPosition(:)';
+            pl = nan(numRx,1);
+
+            % Look up the cached pairs
+            cached = false(numRx,1);
+            cacheIdx = zeros(numRx,1);
+            if isCacheable(obj)
+                txIdx = sig.TransmitterID;
+                txValid = isscalar(txIdx) && txIdx>=1 && txIdx<=obj.NumNodes && numel(txPosition)==3;
+                valid = txValid & rxIDs>=1 & rxIDs<=obj.NumNodes;
+                cacheIdx(valid) = sub2ind([obj.NumNodes obj.NumNodes],txIdx*ones(nnz(valid),1),rxIDs(valid));
+                rows = nan(numRx,7);
+                rows(valid,:) = obj.PathLossCache(cacheIdx(valid),:);
+                cached = valid & all(rows(:,2:7)==[repmat(txPosition,numRx,1) rxPositions],2);
+                pl(cached) = rows(cached,1);
+            end
+
+            % Evaluate the others
+            missing = ~cached;
+            if any(missing)
+                if strcmp(obj.PathLossModel,'custom') && ~obj.VectorizedPathLossModelFcn
+                    for i = find(missing)'
+                        rx = rxInfo;
+                        rx.ID = rxIDs(i);
+                        rx.Position = rxPositions(i,:);
+                        pl(i) = obj.PathLossModelFcn(sig,rx);
+                    end
+                else
+                    rx = rxInfo;
+                    rx.ID = rxIDs(missing);
+                    rx.Position = rxPositions(missing,:);
+                    pl(missing) = evaluatePathLoss(obj,sig,rx);
+                end
+                store = missing & cacheIdx>0;
+                obj.PathLossCache(cacheIdx(store),:) = [pl(store) repmat(txPosition,nnz(store),1) rxPositions(store,:)];
+            end
+        end
+
+        function l = getLargeScaleLoss(obj, sig, rxInfo)
+            % L = getLargeScaleLoss(OBJ,SIG,RXINFO) returns the path loss
+            % minus the shadow fading in dB from the transmitter of SIG to
+            % the receiver RXINFO, by node index. Both are fixed for a link
+            % while the nodes do not move, unlike the fading. L is NaN if
+            % the path loss model is custom and may change from packet to
+            % packet.
+
+            l = NaN;
+            if isCacheable(obj)
+                l = getPathLoss(obj,sig,rxInfo) - getShadowFading(obj,sig.TransmitterID,rxInfo.ID);
+            end
+        end
+
+        function pl = precomputePathLoss(obj, positions)
+            % PL = precomputePathLoss(OBJ,POSITIONS) evaluates the path
+            % loss between all pairs of the nodes, whose positions are the
+            % rows of the N-by-3 matrix POSITIONS (by node index), and
+            % caches it. PL is the N-by-N matrix of path losses in dB from
+            % the transmitter (row) to the receiver (column). The cache is
+            % used while the nodes do not move, so that no path loss is
+            % evaluated during the simulation of a static topology. PL is
+            % empty if the path loss model cannot be cached.
+
+            pl = [];
+            if ~isCacheable(obj)
+                return
+            end
+            numNodes = size(positions,1);
+            pl = zeros(numNodes,numNodes);
+            for txIdx = 1:numNodes
+                sig = struct('TransmitterID',txIdx,'TransmitterPosition',positions(txIdx,:));
+                rxInfo = struct('ID',(1:numNodes)','Position',positions);
+                pl(txIdx,:) = getPathLosses(obj,sig,rxInfo);
             end
-            disp(['Path loss model: ', obj.PathLossModel]);
+        end
+    end
+
+    methods
+        function set.PathLossModel(obj,val)
+            obj.PathLossModel = val;
+            % Cached path losses are only valid for the model used
+            obj.PathLossCache(:) = NaN; %#ok<MCSUP>
+        end
+
+        function set.PathLossModelFcn(obj,val)
+            obj.PathLossModelFcn = val;
+            obj.PathLossCache(:) = NaN; %#ok<MCSUP>
+        end
+
+        function set.VectorizedPathLossModelFcn(obj,val)
+            obj.VectorizedPathLossModelFcn = val;
+            obj.PathLossCache(:) = NaN; %#ok<MCSUP>
+        end
+
+        function set.CenterFrequency(obj,val)
+            obj.CenterFrequency = val;
+            obj.PathLossCache(:) = NaN; %#ok<MCSUP>
         end
     end
 
     methods (Access=protected)
+        function poolIdx = filterPoolIndex(obj,idx)
+            % POOLIDX = filterPoolIndex(OBJ,IDX) returns the index in the
+            % pool of path delays and filters for the channel index IDX.
+            % The path delays and filters only depend on the channel class,
+            % delay profile, sample rate and output normalization, so they
+            % are computed once for all the links with the same values.
+
+            poolIdx = obj.LinkFilterPoolIndex(idx);
+            if poolIdx>0
+                return
+            end
+            chan = obj.Channels{idx};
+            key = join([string(class(chan)) string(chan.DelayProfile) ...
+                string(num2str(obj.Links(idx).SampleRate,17)) string(chan.NormalizeChannelOutputs)],"/");
+            poolIdx = find(obj.FilterPoolKeys==key,1);
+            if isempty(poolIdx)
+                chanInfo = info(chan);
+                % Channel filter in obj.Channel may be configured for
+                % lowest sample rate, so calculate path filters externally
+                channelFilter = comm.ChannelFilter( ...
+                    'SampleRate', obj.Links(idx).SampleRate, ...
+                    'PathDelays', double(chanInfo.PathDelays), ...
+                    'NormalizeChannelOutputs', chan.NormalizeChannelOutputs);
+                obj.FilterPoolKeys(end+1,1) = key;
+                obj.FilterPool(end+1) = struct('PathDelays',chanInfo.PathDelays, ...
+                    'PathFilters',info(channelFilter).ChannelFilterCoefficients);
+                poolIdx = numel(obj.FilterPool);
+            end
+            obj.LinkFilterPoolIndex(idx) = poolIdx;
+        end
+
         function [idx,switched] = sub2chanInd(obj,txIdx,rxIdx)
             % Returns the channel index given the transmit and receive node
             % indices
-            [txIdxUse,rxIdxUse,switched] = sub2chanIndRecip(txIdx,rxIdx);
-            idx = all(obj.ChanIndLUT == [txIdxUse rxIdxUse],2);
+            [~,~,switched] = sub2chanIndRecip(txIdx,rxIdx);
+            idx = 0;
+            if txIdx>=1 && rxIdx>=1 && txIdx<=obj.NumNodes && rxIdx<=obj.NumNodes
+                idx = obj.ChanIndMatrix(txIdx,rxIdx);
+            end
             % Check that the channel has been created, if not it will be
             % NaNs. A channel does not exist between a node and itself.
-            if ~any(idx) || isempty(obj.Links(idx).Channel)
+            if idx==0 || isempty(obj.Links(idx).Channel)
                 error('hSLSTGaxSystemChannelBase:NoChannelExists','Channel does not exist between node #%d and #%d.',txIdx,rxIdx)
             end
         end
@@ -478,7 +689,7 @@ classdef hSLSTGaxSystemChannelBase < handle
             W = 0; % Number of walls penetrated
             % Enterprise
             dBP = 10; % breakpoint distance
-            pl = 40.052 + 20*log10((obj.CenterFrequency/1e9)/2.4) + 20*log10(min(d,dBP)) + (d>dBP) * 35*log10(d/dBP) + 7*W;
+            pl = 40.052 + 20*log10((obj.CenterFrequency/1e9)/2.4) + 20*log10(min(d,dBP)) + (d>dBP) .* 35.*log10(d/dBP) + 7*W;
         end
 
         function pl = tgaxResidentialPathLoss(obj, d)
@@ -491,7 +702,7 @@ classdef hSLSTGaxSystemChannelBase < handle
             W = 0; % Number of walls penetrated
             % Residential
             dBP = 5;
-            pl = 40.052 + 20*log10((obj.CenterFrequency/1e9)/2.4) + 20*log10(min(d,dBP)) + (d>dBP) * 35*log10(d/dBP) + 18.3*F^((F+2)/(F+1)-0.46) + 5*W;
+            pl = 40.052 + 20*log10((obj.CenterFrequency/1e9)/2.4) + 20*log10(min(d,dBP)) + (d>dBP) .* 35.*log10(d/dBP) + 18.3*F^((F+2)/(F+1)-0.46) + 5*W;
         end
 
         function pl = freeSpacePathLoss(obj, d)
@@ -502,6 +713,45 @@ classdef hSLSTGaxSystemChannelBase < handle
             pl = fspl(d, obj.LightSpeed/obj.CenterFrequency);
         end
 
+        function cacheIdx = pathLossCacheIndex(obj, sig, rxInfo)
+            %pathLossCacheIndex returns the row of the path loss cache for
+            %the transmitter and receiver node indices, or 0 if the path
+            %loss cannot be cached.
+            cacheIdx = 0;
+            txIdx = sig.TransmitterID;
+            rxIdx = rxInfo.ID;
+            if isCacheable(obj) && ...
+                    isscalar(txIdx) && isscalar(rxIdx) && ...
+                    txIdx>=1 && rxIdx>=1 && txIdx<=obj.NumNodes && rxIdx<=obj.NumNodes && ...
+                    numel(sig.TransmitterPosition)==3 && numel(rxInfo.Position)==3
+                cacheIdx = sub2ind([obj.NumNodes obj.NumNodes],txIdx,rxIdx);
+            end
+        end
+
+        function flag = isCacheable(obj)
+            %isCacheable returns true if the path loss only depends on the
+            %node positions
+            flag = ~strcmp(obj.PathLossModel,'custom') || obj.VectorizedPathLossModelFcn;
+        end
+
+        function pl = evaluatePathLoss(obj, sig, rxInfo)
+            %evaluatePathLoss returns the path loss in dB of the model to
+            %the receivers in the rows of rxInfo.Position
+            d = vecnorm(rxInfo.Position - sig.TransmitterPosition(:)', 2, 2);
+
+            switch obj.PathLossModel
+                case 'free-space'
+                    pl = freeSpacePathLoss(obj, d);
+                case 'residential'
+                    pl = tgaxResidentialPathLoss(obj, d);
+                case 'enterprise'
+                    pl = tgaxEnterprisePathLoss(obj, d);
+                case 'custom'
+                    pl = obj.PathLossModelFcn(sig,rxInfo);
+            end
+            pl = reshape(pl,[],1);
+        end
+
         function idx = channelIndex(obj,varargin)
             %channelIndex returns the channel index given either the
             %channel index or transmitter and receiver node index.
@@ -0,0 +1,104 @@
+classdef hWLANScenarioBatch < handle
+%hWLANScenarioBatch Build a WLAN topology once and fork it for many runs
+%
+%   BATCH = hWLANScenarioBatch(BUILDFCN) creates a batch of runs which share
+%   their topology. BUILDFCN is a function handle with the signature
+%
+%       SCENARIO = BUILDFCN(SIMULATOR,KEY)
+%
+%   It creates the nodes with their device configurations, associates the
+%   stations and adds the channel model to the wirelessNetworkSimulator
+%   SIMULATOR for the topology parameters KEY, e.g. the station position.
+%   SCENARIO is a structure with the created objects, which must have a
+%   Nodes field with all the nodes. Traffic sources are not added by
+%   BUILDFCN, since they change from run to run.
+%
+%   [SIMULATOR,SCENARIO] = fork(BATCH,KEY) returns a simulator, with the
+%   nodes added and not yet run, and the scenario of KEY. The first fork of
+%   a KEY calls BUILDFCN and saves the built network with the simulator
+%   checkpoint method, so that the objects, the PHY configuration and the
+%   channel are constructed once. The next forks of the same KEY restore
+%   an independent copy of that snapshot instead, so each run starts from
+%   the same dynamic state: empty queues, no scheduled action and time 0.
+%   Add the traffic sources, the listeners and the visualization after
+%   fork, then call run.
+%
+%   Like restore, fork leaves the global random number stream in the state
+%   it had after BUILDFCN, the state saved with the snapshot. To get the
+%   same results from a fork and from a new build, seed the global stream
+%   before fork, and put everything that sets the seed in KEY.
+%
+%   The snapshots are written to temporary files, removed when BATCH is
+%   deleted. For a pool of workers, create one batch per worker, for
+%   example with parallel.pool.Constant, rather than passing a batch to
+%   the tasks.
+%
+%   hWLANScenarioBatch properties (read-only):
+%
+%   BuildFcn  - Function handle which builds a topology
+%   NumBuilds - Number of topologies built
+%   NumForks  - Number of forks returned
+%
+%   hWLANScenarioBatch methods:
+%
+%   fork - Return a fresh copy of the built topology of a key
+
+    properties (SetAccess=private)
+        %BuildFcn Function handle which builds a topology
+        BuildFcn
+
+        %NumBuilds Number of topologies built
+        NumBuilds = 0
+
+        %NumForks Number of forks returned
+        NumForks = 0
+    end
+
+    properties (Access=private)
+        %pKeys Key of each built topology
+        pKeys = {}
+
+        %pFiles Snapshot file of each built topology
+        pFiles = strings(0,1)
+    end
+
+    methods
+        function obj = hWLANScenarioBatch(buildFcn)
+            arguments
+                buildFcn (1,1) function_handle
+            end
+            obj.BuildFcn = buildFcn;
+        end
+
+        function [simulator,scenario] = fork(obj,key)
+            %fork Return a simulator and a scenario of the key, ready to run
+
+            obj.NumForks = obj.NumForks+1;
+            idx = find(cellfun(@(k) isequal(k,key),obj.pKeys),1);
+            if ~isempty(idx)
+                [simulator,scenario] = wirelessNetworkSimulator.restore(obj.pFiles(idx));
+                return
+            end
+
+            % Build the topology and keep a snapshot of it before it runs.
+            % This first run uses the built objects themselves.
+            simulator = wirelessNetworkSimulator.init;
+            scenario = obj.BuildFcn(simulator,key);
+            addNodes(simulator,scenario.Nodes);
+            snapshotFile = string(tempname)+".mat";
+            checkpoint(simulator,snapshotFile,scenario);
+            obj.pKeys{end+1} = key;
+            obj.pFiles(end+1) = snapshotFile;
+            obj.NumBuilds = obj.NumBuilds+1;
+        end
+
+        function delete(obj)
+            %delete Remove the snapshot files
+            for idx = 1:numel(obj.pFiles)
+                if isfile(obj.pFiles(idx))
+                    delete(obj.pFiles(idx));
+                end
+            end
+        end
+    end
+end
@@ -1,12 +1,19 @@
 #!/bin/bash
 
-# Define the range of arrival rates (100, 200, ..., 10000)
-arrival_rates=$(seq 100 100 10000)
+# Usage: ./run_simulations.sh "<STA position>" <simulation duration (s)> [results file]
+# Example: ./run_simulations.sh "[10 0 0]" 10 performance_results_v4.csv
+if [ $# -lt 2 ]; then
+    echo "Usage: $0 \"<STA position>\" <simulation duration (s)> [results file]"
+    exit 1
+fi
+sta_position=$1
+duration=$2
+results_file=${3:-performance_results_v4.csv}
 
-# Run MATLAB script for each arrival rate
-for rate in $arrival_rates; do
-    echo "*** Running simulation for arrival rate: $rate"
-    matlab -batch "simulate(\"$rate\")"
-done
+# Run the sweep over the arrival rates (100, 200, ..., 10000) in a single
+# MATLAB session. run_sweep dispatches the rates over a pool of warm worker
+# processes and appends each row to the results file as it finishes.
+echo "*** Running simulations for arrival rates 100:100:10000"
+matlab -batch "run_sweep($sta_position, $duration, ArrivalRates=100:100:10000, ResultsFile=\"$results_file\")"
 
 echo "All simulations completed!"
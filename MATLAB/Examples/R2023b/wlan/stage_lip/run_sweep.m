@@ -0,0 +1,156 @@
+function results = run_sweep(staPosition, simulationDuration, options)
+    % RESULTS = run_sweep(STAPOSITION, SIMULATIONDURATION) runs
+    % simulate_simple for the arrival rates 100:100:10000 packets per second
+    % and returns one row per rate: [ArrivalRate, NbSentPackets,
+    % NbReceivedPackets, Latency, Throughput].
+    %
+    % The rates are independent tasks. They are dispatched over a pool of
+    % worker processes, one per core, which stay warm for the whole sweep,
+    % so MATLAB and toolbox startup is paid once per worker instead of once
+    % per rate. Task k uses substream k of the "combRecursive" generator
+    % seeded with Seed, so the results do not depend on which worker runs
+    % a task or in which order the tasks finish. Without Parallel Computing
+    % Toolbox the tasks run one after another in the current process.
+    %
+    % Each row is appended to ResultsFile as soon as its task finishes. Rows
+    % are therefore written in completion order, not in rate order. The
+    % p50/p90/p99/p99.9 of the end-to-end latency and of the MAC queueing
+    % delay of each rate are appended the same way to QuantilesFile (default
+    % "latency_quantiles_v4.csv", "" to skip it), with the columns of
+    % simulate_simple QuantilesFile.
+    %
+    % run_sweep(..., ArrivalRates=R, Seed=S, ResultsFile=F, NumWorkers=N)
+    % overrides the arrival rates, the seed (default 1), the CSV file
+    % (default "performance_results_v4.csv") and the pool size (default is
+    % the cluster profile default).
+    %
+    % run_sweep(..., Headless=false) keeps the visualization of each run.
+    % The default is true, which only computes the exported metrics.
+    %
+    % run_sweep(..., ReuseTopology=true) keeps one hWLANScenarioBatch per
+    % process, so that the topology of the sweep (nodes, device
+    % configurations, association and channel) is forked rather than
+    % built. The topology draws from the seeded stream of its task, and a
+    % fork carries the stream saved after the build, so a snapshot is only
+    % reused by the tasks of the same seed and substream. Since every task
+    % has its own substream, the sweep builds the topology in every task
+    % either way, and the default is false, which also skips the snapshot
+    % writes. Both give the same results as separate simulate_simple calls.
+    %
+    % run_sweep(..., StoreFile=F, Scenario=S) also appends all the rows to
+    % the binary results store F, shared with the ns-3 and iperf runs, under
+    % scenario number S. The default is
+    % "~/Documents/digital_twins/metrics/results.bin" and scenario 1. Set F
+    % to "" to write only the CSV file.
+    arguments
+        staPosition
+        simulationDuration
+        options.ArrivalRates (1,:) double {mustBePositive} = 100:100:10000
+        options.Seed (1,1) double = 1
+        options.ResultsFile (1,1) string = "performance_results_v4.csv"
+        options.QuantilesFile (1,1) string = "latency_quantiles_v4.csv"
+        options.NumWorkers double = []
+        options.Headless (1,1) logical = true
+        options.StoreFile (1,1) string = "~/Documents/digital_twins/metrics/results.bin"
+        options.Scenario (1,1) double {mustBeInteger, mustBeNonnegative} = 1
+        options.ReuseTopology (1,1) logical = false
+    end
+
+    arrivalRates = options.ArrivalRates;
+    numTasks = numel(arrivalRates);
+    results = nan(numTasks, 5);
+    resultRows = strings(numTasks, 7);
+
+    % Create the results file with its header
+    fileID = fopen(options.ResultsFile, 'w');
+    fprintf(fileID, 'ArrivalRate,NbSentPackets,NbReceivedPackets,Latency,Throughput\n');
+    fclose(fileID);
+    % The quantiles file is created with its header by the first append
+    if options.QuantilesFile ~= "" && isfile(options.QuantilesFile)
+        delete(options.QuantilesFile);
+    end
+
+    % The rows are returned to the sweep, which owns the results file
+    taskArgs = @(k) {staPosition, arrivalRates(k), simulationDuration, ...
+        'Seed', options.Seed, 'Substream', k, 'ResultsFile', "", ...
+        'Headless', options.Headless};
+
+    if isempty(ver('parallel'))
+        % Run the tasks in the current process
+        if options.ReuseTopology
+            batch = hWLANScenarioBatch(@build_simple_scenario);
+            taskFcn = @(varargin) simulate_simple(varargin{:}, 'Batch', batch);
+        else
+            taskFcn = @simulate_simple;
+        end
+        for k = 1:numTasks
+            args = taskArgs(k);
+            [resultRows(k, :), quantileRow] = taskFcn(args{:});
+            results(k, :) = appendResult(options.ResultsFile, resultRows(k, :));
+            appendQuantiles(options.QuantilesFile, resultRows(k, :), quantileRow);
+            fprintf('*** Completed arrival rate %g (%d/%d)\n', arrivalRates(k), k, numTasks);
+        end
+        storeResults(options, resultRows);
+        return;
+    end
+
+    % Start the pool once and dispatch all the tasks
+    pool = gcp('nocreate');
+    if isempty(pool)
+        if isempty(options.NumWorkers)
+            pool = parpool('Processes');
+        else
+            pool = parpool('Processes', options.NumWorkers);
+        end
+    end
+    if options.ReuseTopology
+        % One batch per worker, created on the worker and kept for all the
+        % tasks it runs
+        batch = parallel.pool.Constant(@() hWLANScenarioBatch(@build_simple_scenario));
+        taskFcn = @(varargin) simulate_simple(varargin{:}, 'Batch', batch.Value);
+    else
+        taskFcn = @simulate_simple;
+    end
+    futures(1:numTasks) = parallel.FevalFuture;
+    for k = 1:numTasks
+        args = taskArgs(k);
+        futures(k) = parfeval(pool, taskFcn, 2, args{:});
+    end
+    % Cancel the outstanding tasks if the sweep is interrupted
+    cancelFutures = onCleanup(@() cancel(futures));
+
+    % Stream the rows into the results file as the tasks finish
+    for n = 1:numTasks
+        [k, resultRow, quantileRow] = fetchNext(futures);
+        resultRows(k, :) = resultRow;
+        results(k, :) = appendResult(options.ResultsFile, resultRow);
+        appendQuantiles(options.QuantilesFile, resultRow, quantileRow);
+        fprintf('*** Completed arrival rate %g (%d/%d)\n', arrivalRates(k), n, numTasks);
+    end
+    clear cancelFutures
+    storeResults(options, resultRows);
+end
+
+function row = appendResult(filename, resultRow)
+    % Convert a simulate_simple result row to [ArrivalRate, NbSentPackets,
+    % NbReceivedPackets, Latency, Throughput] and append it to the file
+
+    row = double(resultRow([1 4 5 6 7]));
+    writematrix(row, filename, 'WriteMode', 'append');
+end
+
+function appendQuantiles(filename, resultRow, quantileRow)
+    % Append the latency and queueing delay quantiles of one rate, in the
+    % layout of simulate_simple QuantilesFile
+    if filename ~= ""
+        append_latency_quantiles(filename, resultRow, quantileRow);
+    end
+end
+
+function storeResults(options, resultRows)
+    % Append the rows of the sweep to the binary results store, in rate
+    % order and with one write
+    if options.StoreFile ~= ""
+        append_results_store(options.StoreFile, resultRows, Scenario=options.Scenario);
+    end
+end
@@ -1,18 +1,33 @@
 function simulate_2stas(distanceAp1Ap2, rate, simulationDuration)
-    
+    % simulate_2stas(DISTANCEAP1AP2, RATE, SIMULATIONDURATION) simulates two
+    % BSSs, STA1->AP1 and STA2->AP2, with the APs DISTANCEAP1AP2 meters
+    % apart, at the arrival rate RATE (packets per second) for
+    % SIMULATIONDURATION seconds, and appends one result row per flow to
+    % matlab_results_2stas.csv.
+    %
+    % RATE can be a vector of arrival rates, and SIMULATIONDURATION a scalar
+    % or a vector of the same size. The nodes, their configuration, the
+    % association and the channel do not depend on the rate, so they are
+    % built once with hWLANScenarioBatch and forked at t=0 for every rate.
+    % Each rate starts from seed 1 as a separate call would.
+
     % --[Check if the Comm Toolbox is installed]--
     wirelessnetworkSupportPackageCheck;
 
-    % --[Configure Simulation Parameters]--
+    % hWLANScenarioBatch est dans le dossier parent ; les copies locales
+    % des helpers restent prioritaires
+    addpath(fileparts(fileparts(mfilename('fullpath'))), '-end');
 
-    % Set the seed to 1 : affects backoff counter selection (L2), packet reception success (L1)
-    rng(1, "combRecursive");
+    % --[Configure Simulation Parameters]--
 
-    % Set the arrival rate
-    arrivalRate = str2double(rate + "");
+    % Set the arrival rates
+    arrivalRates = str2double(rate + "");
 
-    % Set the simulation time (in seconds)
-    simulationTime = str2double(simulationDuration + "");
+    % Set the simulation times (in seconds)
+    simulationTimes = str2double(simulationDuration + "");
+    if isscalar(simulationTimes)
+        simulationTimes = repmat(simulationTimes, size(arrivalRates));
+    end
 
     % Visualization flags
     enablePacketVisualization = true;
@@ -31,8 +46,112 @@ function simulate_2stas(distanceAp1Ap2, rate, simulationDuration)
     % Buffer Size
     bufferSize = 500;
 
+    % Distance between AP1 and AP2 in meters
+    distAp1Ap2 = str2double("" + distanceAp1Ap2);
+
     % --[Configure WLAN Scenario]--
-    networkSimulator = wirelessNetworkSimulator.init;
+    % Built once, on the first rate
+    batch = hWLANScenarioBatch(@(networkSimulator, distance) buildScenario(networkSimulator, distance, ...
+        bufferSize, PHYAbstractionMethod, MACFrameAbstraction));
+
+    for k = 1:numel(arrivalRates)
+        arrivalRate = arrivalRates(k);
+        simulationTime = simulationTimes(k);
+
+        % Set the seed to 1 : affects backoff counter selection (L2), packet reception success (L1)
+        % Seeded before the fork, so a forked run draws the same numbers as a new build
+        rng(1, "combRecursive");
+        [networkSimulator, scenario] = fork(batch, distAp1Ap2);
+        apNodes = scenario.APs;
+        staNodes = scenario.STAs;
+        nodes = scenario.Nodes;
+        numSTAs = numel(staNodes);
+
+        % --[Configure External Application Traffic]--
+        for i = 1:numSTAs
+            % Uplink (STA to AP)
+            trafficUP = networkTrafficOnOff( ...
+                DataRate=(arrivalRate * packetSize * 8)/1000, ...
+                PacketSize=packetSize, ...
+                OnTime=Inf, OffTime=0);
+            addTrafficSource(staNodes(i), trafficUP, DestinationNode=apNodes(i), AccessCategory=0);
+        end
+
+        % --[Packet Capture]--
+        if capturePacketsFlag
+            capturePacketsObj = hExportWLANPackets(nodes);
+        end
+
+        % --[Simulation and Results]--
+        if enablePacketVisualization
+            packetVisObj = hPlotPacketTransitions(nodes, simulationTime, FrequencyPlotFlag=false);
+        end
+
+        if enableNodePerformancePlot
+            performancePlotObj = hVisualizePerformance(nodes, simulationTime);
+        end
+
+        % Run the simulator (the nodes are added by the batch)
+        run(networkSimulator, simulationTime);
+
+        % Delete PCAP objects
+        if capturePacketsFlag
+            delete(capturePacketsObj.PCAPObjList);
+        end
+
+        % Retrieve the APP, MAC and PHY statistics at each node
+        apStats = statistics(apNodes);
+        stasStats = statistics(staNodes);
+
+        % Retrieve Performance Metrics
+        avgLatency = performancePlotObj.getAveragePacketLatency();
+        throughput = performancePlotObj.getThroughput();
+
+        % Store Results
+        resultRows = [
+            [
+                arrivalRate, ...
+                simulationTime, ...
+                "STA1->AP1", ...
+                "" + stasStats(1).App.TransmittedPackets, ...
+                "" + apStats(1).App.ReceivedPackets, ...
+                avgLatency(1,2), ... % latency at AP
+                throughput(3,2) ...- % throughput of STA1 (traffic STA1->AP1)
+            ]; ...
+            [
+                arrivalRate, ...
+                simulationTime, ...
+                "STA2->AP2", ...
+                "" + stasStats(2).App.TransmittedPackets, ...
+                "" + apStats(2).App.ReceivedPackets, ...
+                avgLatency(1,2), ... % latency at AP
+                throughput(4,2) ...- % throughput of STA2 (traffic STA2->AP2)
+            ]
+        ];
+
+        for i = 1:numSTAs
+            resultRow = resultRows(i,:);
+            % disp(resultRow);
+
+            % Define Output File
+            filename = '~/Documents/digital_twins/metrics/matlab_results_2stas.csv';
+
+            % Check if file exists, append data or create with headers
+            if isfile(filename)
+                writematrix(resultRow, filename, 'WriteMode', 'append');
+            else
+                headers = ["Arrival Rate (pps)", "Simulation Duration (s)", "Flow Direction", "Packets Sent", "Packets Received", "Average Delay (s)", "Throughput"];
+                writematrix([headers; resultRow], filename);
+            end
+        end
+
+        disp(['Simulation completed for Arrival Rate: ', num2str(arrivalRate)]);
+    end
+end
+
+function scenario = buildScenario(networkSimulator, distAp1Ap2, bufferSize, PHYAbstractionMethod, MACFrameAbstraction)
+    % Build the nodes, the association and the channel for the distance
+    % between AP1 and AP2, without traffic
 
     % Number of Nodes
     % numNodes = 4;
@@ -40,7 +159,6 @@ function simulate_2stas(distanceAp1Ap2, rate, simulationDuration)
     numSTAs = 2;
 
     % Nodes Positions
-    distAp1Ap2 = str2double("" + distanceAp1Ap2); % Distance between AP1 and AP2 in meters
     apPositions = [0 0 0; distAp1Ap2 0 0];
     staPositions = [0 10 0; distAp1Ap2 10 0];
 
@@ -61,11 +179,11 @@ function simulate_2stas(distanceAp1Ap2, rate, simulationDuration)
         TransmissionFormat="HT-Mixed", ...
         TransmitPower=16.02, ...
         TransmitQueueSize=bufferSize);    % STA device configuration
-    
+
     % Create Nodes
     apNodes = wlanNode(Name="AP"+(1:numAPs), Position=apPositions, DeviceConfig=apConfig, PHYAbstractionMethod=PHYAbstractionMethod, MACFrameAbstraction=MACFrameAbstraction);
     staNodes = wlanNode(Name="STA"+(1:numSTAs), Position=staPositions, DeviceConfig=staConfig, PHYAbstractionMethod=PHYAbstractionMethod, MACFrameAbstraction=MACFrameAbstraction);
-             
+
     % Create WLAN Network
     nodes = [apNodes staNodes];
 
@@ -78,22 +196,12 @@ function simulate_2stas(distanceAp1Ap2, rate, simulationDuration)
         associateStations(apNodes(i), staNodes(i));
     end
 
-    % --[Configure External Application Traffic]--
-    for i = 1:numSTAs
-        % Uplink (STA to AP)
-        trafficUP = networkTrafficOnOff( ...
-            DataRate=(arrivalRate * packetSize * 8)/1000, ...
-            PacketSize=packetSize, ...
-            OnTime=Inf, OffTime=0);
-        addTrafficSource(staNodes(i), trafficUP, DestinationNode=apNodes(i), AccessCategory=0);
-    end
-
     % Wireless Channel
-        % The 802.11n channel object uses a filtered Gaussian noise model in which 
-        % ...the path delays, powers, angular spread, angles of arrival, and angles of departure 
-        % ...are determined empirically. The specific modeling approach is described in [1]. 
-        % TransmitReceiveDistance is used to compute the path loss, and to determine whether the channel has 
-        % ...a line of sight (LOS) or non line of sight (NLOS) condition. The path loss 
+        % The 802.11n channel object uses a filtered Gaussian noise model in which
+        % ...the path delays, powers, angular spread, angles of arrival, and angles of departure
+        % ...are determined empirically. The specific modeling approach is described in [1].
+        % TransmitReceiveDistance is used to compute the path loss, and to determine whether the channel has
+        % ...a line of sight (LOS) or non line of sight (NLOS) condition. The path loss
         % ...and standard deviation of shadow fading loss depend on the separation between the transmitter and the receiver.
         % Model-A : d_BP = 5m -> path_loss exponent = 3.5, shadow_fading std = 4 max_delay=0ns
         % ...ref: https://fr.mathworks.com/help/wlan/ref/wlantgnchannel-system-object.html
@@ -101,10 +209,12 @@ function simulate_2stas(distanceAp1Ap2, rate, simulationDuration)
                     'TransmitReceiveDistance',10,...
                     'LargeScaleFadingEffect','None', ...    % 'None' (default) | 'Pathloss' | 'Shadowing' | 'Pathloss and shadowing'
                     'EnvironmentalSpeed', 0);   % Speed of the scatterers (diffuseurs : batiments, vehicules, etc.) in km/h
-    
+
     % channel = hSLSTGaxMultiFrequencySystemChannel(nodes, tgnChan);
     % Définir un modèle logarithmique personnalisé
     % PL = PL_0 + 10 * n * log10(d/d_0), avec PL_0 à d_0 = 1 m
+    % Fonction locale et non imbriquée : le canal est sauvegardé dans le
+    % snapshot du batch, sans l'espace de travail de simulate_2stas
     customPathLoss = @(sig, rxInfo) customLogarithmicPathLoss(sig, rxInfo);
     % Ecart-type du shadowfading
     shadowFadingStd = 0; % default : 0
@@ -113,93 +223,22 @@ function simulate_2stas(distanceAp1Ap2, rate, simulationDuration)
     channel = hSLSTGaxMultiFrequencySystemChannel(nodes, tgnChan, ...
         ShadowFadingStandardDeviation=shadowFadingStd, ...
         PathLossModel='custom', ... % default : free-space
-        PathLossModelFcn=customPathLoss);
+        PathLossModelFcn=customPathLoss, ...
+        VectorizedPathLossModelFcn=true); % le modèle ne dépend que des positions
 
     addChannelModel(networkSimulator, channel.ChannelFcn);
 
-
-    % --[Packet Capture]--
-    if capturePacketsFlag
-        capturePacketsObj = hExportWLANPackets(nodes);
-    end
-
-    % --[Simulation and Results]--
-    if enablePacketVisualization
-        packetVisObj = hPlotPacketTransitions(nodes, simulationTime, FrequencyPlotFlag=false);
-    end
-
-    if enableNodePerformancePlot
-        performancePlotObj = hVisualizePerformance(nodes, simulationTime);
-    end
-
-    % Run the simulator
-    addNodes(networkSimulator, nodes);
-    run(networkSimulator, simulationTime);
-
-    % Delete PCAP objects
-    if capturePacketsFlag
-        delete(capturePacketsObj.PCAPObjList);
-    end
-
-    % Retrieve the APP, MAC and PHY statistics at each node
-    apStats = statistics(apNodes);
-    stasStats = statistics(staNodes);
-
-    % Retrieve Performance Metrics
-    avgLatency = performancePlotObj.getAveragePacketLatency();
-    throughput = performancePlotObj.getThroughput();
-
-    % Store Results
-    resultRows = [
-        [
-            arrivalRate, ...
-            simulationTime, ...
-            "STA1->AP1", ...
-            "" + stasStats(1).App.TransmittedPackets, ...
-            "" + apStats(1).App.ReceivedPackets, ...
-            avgLatency(1,2), ... % latency at AP
-            throughput(3,2) ...- % throughput of STA1 (traffic STA1->AP1)
-        ]; ...
-        [
-            arrivalRate, ...
-            simulationTime, ...
-            "STA2->AP2", ...
-            "" + stasStats(2).App.TransmittedPackets, ...
-            "" + apStats(2).App.ReceivedPackets, ...
-            avgLatency(1,2), ... % latency at AP
-            throughput(4,2) ...- % throughput of STA2 (traffic STA2->AP2)
-        ]
-    ];
-
-    for i = 1:numSTAs
-        resultRow = resultRows(i,:);
-        % disp(resultRow);
-
-        % Define Output File
-        filename = '~/Documents/digital_twins/metrics/matlab_results_2stas.csv';
-        
-        % Check if file exists, append data or create with headers
-        if isfile(filename)
-            writematrix(resultRow, filename, 'WriteMode', 'append');
-        else
-            headers = ["Arrival Rate (pps)", "Simulation Duration (s)", "Flow Direction", "Packets Sent", "Packets Received", "Average Delay (s)", "Throughput"];
-            writematrix([headers; resultRow], filename);
-        end
-    end
-
-    disp(['Simulation completed for Arrival Rate: ', num2str(arrivalRate)]);
-
-    % Fonction personnalisée pour un modèle logarithmique
-    function pl = customLogarithmicPathLoss(sig, rxInfo)
-        d = norm(sig.TransmitterPosition - rxInfo.Position); % Distance en mètres
-        d_0 = 1; % Distance de référence (1 m)
-        PL_0 = 46.677; % Perte de référence à d_0 = 1 m (comme sur ns-3)
-        n = 3.0; % Exposant de perte (comme sur ns-3)
-        
-        % Modèle logarithmique : PL = PL_0 + 10 * n * log10(d/d_0)
-        pl = PL_0 + 10 * n * log10(d/d_0);
-        % disp(['Perte logarithmique appliquée : ', num2str(pl), ' dB']);
-    end
+    scenario = struct(Nodes=nodes, APs=apNodes, STAs=staNodes);
 end
 
+% Fonction personnalisée pour un modèle logarithmique
+function pl = customLogarithmicPathLoss(sig, rxInfo)
+    d = vecnorm(rxInfo.Position - sig.TransmitterPosition, 2, 2); % Distance en mètres, une ligne par récepteur
+    d_0 = 1; % Distance de référence (1 m)
+    PL_0 = 46.677; % Perte de référence à d_0 = 1 m (comme sur ns-3)
+    n = 3.0; % Exposant de perte (comme sur ns-3)
 
+    % Modèle logarithmique : PL = PL_0 + 10 * n * log10(d/d_0)
+    pl = PL_0 + 10 * n * log10(d/d_0);
+    % disp(['Perte logarithmique appliquée : ', num2str(pl'), ' dB']);
+end
@@ -106,7 +106,8 @@ function simulate_simple(staPosition, rate, simulationDuration)
     channel = hSLSTGaxMultiFrequencySystemChannel(nodes, tgnChan, ...
         ShadowFadingStandardDeviation=shadowFadingStd, ...
         PathLossModel='custom', ... % default : free-space
-        PathLossModelFcn=customPathLoss);
+        PathLossModelFcn=customPathLoss, ...
+        VectorizedPathLossModelFcn=true); % le modèle ne dépend que des positions
 
     addChannelModel(networkSimulator, channel.ChannelFcn);
 
@@ -164,7 +165,7 @@ function simulate_simple(staPosition, rate, simulationDuration)
 
     % Fonction personnalisée pour un modèle logarithmique
     function pl = customLogarithmicPathLoss(sig, rxInfo)
-        d = norm(sig.TransmitterPosition - rxInfo.Position); % Distance en mètres
+        d = vecnorm(rxInfo.Position - sig.TransmitterPosition, 2, 2); % Distance en mètres, une ligne par récepteur
         d_0 = 1; % Distance de référence (1 m)
         PL_0 = 46.677; % Perte de référence à d_0 = 1 m (comme sur ns-3)
         n = 3.0; % Exposant de perte (comme sur ns-3)
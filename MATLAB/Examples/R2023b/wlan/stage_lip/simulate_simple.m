@@ -1,13 +1,92 @@
-function simulate_simple(staPosition, rate, simulationDuration)
+function [resultRow, quantileRow] = simulate_simple(staPosition, rate, simulationDuration, options)
+    % RESULTROW = simulate_simple(STAPOSITION, RATE, SIMULATIONDURATION)
+    % simulates one AP->STA1 flow at the arrival rate RATE (packets per
+    % second) for SIMULATIONDURATION seconds and returns the result row
+    % [rate, duration, flow, sent, received, latency, throughput].
+    %
+    % [RESULTROW, QUANTILEROW] = simulate_simple(...) also returns the
+    % p50, p90, p99 and p99.9 of the end-to-end packet latency at STA1
+    % followed by those of the MAC queueing delay at the AP, in seconds.
+    % They are computed from constant-memory hLatencyHistogram histograms,
+    % so no per-packet record is kept. simulate_simple(...,
+    % QuantilesFile=F) appends QUANTILEROW, after the rate, the duration
+    % and the flow, to the CSV file F with append_latency_quantiles. The
+    % default is "", which does not write it.
+    %
+    % simulate_simple(..., Seed=S, Substream=K) draws the random numbers
+    % of the topology and then of the run from substream K of the
+    % "combRecursive" generator seeded with S. The default is Seed=1,
+    % Substream=1, the single rng(1) stream of separate runs.
+    %
+    % simulate_simple(..., ResultsFile=F) appends the result row to the CSV
+    % file F. Set F to "" to only return the row.
+    %
+    % simulate_simple(..., StoreFile=F) also appends the result row to the
+    % binary results store F (see append_results_store). The default is "",
+    % which does not write to the store.
+    %
+    % simulate_simple(..., Headless=true) runs without packet visualization
+    % or performance plots. It computes only the exported metrics, using
+    % hHeadlessMetrics counters. The default is false.
+    %
+    % simulate_simple(..., Capture=true) streams the MAC frames of all the
+    % nodes to PCAP files with hExportWLANPackets. CaptureSnapLength=N keeps
+    % only the first N bytes of each frame, for example 24 for the MAC
+    % headers. The default is false, and full frames when enabled.
+    %
+    % simulate_simple(..., PHYAbstraction="calibrated") replaces the full
+    % MAC and PHY processing with abstracted frames and the
+    % "tgax-mac-calibration" PHY abstraction. Packet errors are drawn from
+    % the PER-vs-SINR table in PERTableFile (default
+    % "phyAbstractionTable.mat"), measured from the full PHY by
+    % hGeneratePHYAbstractionTable. The default is "none", the full PHY used
+    % to match ns-3.
+    %
+    % simulate_simple(..., CheckpointFile=F, CheckpointTime=T) warm-starts
+    % the run from the simulator snapshot F. If F does not exist, the
+    % network is simulated up to T seconds, including the association and
+    % the warm-up of the queues, the snapshot is saved to F with
+    % wirelessNetworkSimulator checkpoint, and the run continues to
+    % SIMULATIONDURATION. If F exists, it is restored and only the time
+    % after T is simulated, without building the network. The snapshot must
+    % have been taken with the same position, rate, seed, substream and PHY
+    % abstraction. The latency and the quantiles are counted after T,
+    % while the packet counts and the throughput cover the whole run. The
+    % default is "", which runs from t=0 without snapshot.
+    %
+    % simulate_simple(..., Batch=B) takes the nodes, their configuration,
+    % the association and the channel from the hWLANScenarioBatch B, built
+    % with build_simple_scenario, instead of constructing them. B builds
+    % them once per position, PHY abstraction, seed and substream and
+    % forks a copy at t=0 for every run, so only the traffic, the metrics
+    % and the visualization are set up per run. The stream is seeded before
+    % the fork, and the fork leaves it in the state saved after the build,
+    % so the results are identical to a run without B. The default is
+    % empty, which builds the topology in this call.
+    arguments
+        staPosition
+        rate
+        simulationDuration
+        options.Seed (1,1) double = 1
+        options.Substream (1,1) double {mustBeInteger, mustBePositive} = 1
+        options.ResultsFile (1,1) string = "~/Documents/digital_twins/metrics/matlab_results.csv"
+        options.StoreFile (1,1) string = ""
+        options.QuantilesFile (1,1) string = ""
+        options.Headless (1,1) logical = false
+        options.Capture (1,1) logical = false
+        options.CaptureSnapLength (1,1) double {mustBeInteger, mustBePositive} = 65535
+        options.PHYAbstraction (1,1) string {mustBeMember(options.PHYAbstraction, ["none" "calibrated"])} = "none"
+        options.PERTableFile (1,1) string = "phyAbstractionTable.mat"
+        options.CheckpointFile (1,1) string = ""
+        options.CheckpointTime (1,1) double {mustBeNonnegative} = 0
+        options.Batch hWLANScenarioBatch {mustBeScalarOrEmpty} = hWLANScenarioBatch.empty
+    end
     
     % --[Check if the Comm Toolbox is installed]--
     wirelessnetworkSupportPackageCheck;
 
     % --[Configure Simulation Parameters]--
 
-    % Set the seed to 1 : affects backoff counter selection (L2), packet reception success (L1)
-    rng(1, "combRecursive");
-
     % Set the arrival rate
     arrivalRate = str2double(rate + "");
 
@@ -15,92 +94,89 @@ function simulate_simple(staPosition, rate, simulationDuration)
     simulationTime = str2double(simulationDuration + "");
 
     % Visualization flags
-    enablePacketVisualization = true;
-    enableNodePerformancePlot = true;
-
-    % Modeling full MAC and PHY processing
-    MACFrameAbstraction = false;
-    PHYAbstractionMethod = "none";
+    enablePacketVisualization = ~options.Headless;
+    enableNodePerformancePlot = ~options.Headless;
 
     % Packet Capture for analysis
-    capturePacketsFlag = false;
+    capturePacketsFlag = options.Capture;
 
     % Packet Size
     packetSize = 1500; % in bytes
 
-    % Buffer Size
-    bufferSize = 500;
-
     % --[Configure WLAN Scenario]--
-    networkSimulator = wirelessNetworkSimulator.init;
-
-    % Number of Nodes
-    numNodes = 2;
-    numSTAs = numNodes - 1;
-
-    % Nodes Positions
-    apPosition = [0 0 0];
-    % staPositions = [((30/numSTAs) .* (1:numSTAs))', ((30/numSTAs) .* (numSTAs:-1:1))', zeros(numSTAs,1)];
     staPositions = staPosition;
-    disp(staPositions(1))
-
-    % Nodes Configuration
-    apConfig = wlanDeviceConfig(Mode="AP", ...
-        MCS=1, ...
-        ChannelBandwidth=20000000, ...
-        TransmitQueueSize=bufferSize); % AP device configuration
-    staConfig = wlanDeviceConfig(Mode="STA", ...
-        MCS=1, ...
-        ChannelBandwidth=20000000, ...
-        TransmissionFormat="HT-Mixed", ...
-        TransmitPower=16.02, ...
-        TransmitQueueSize=bufferSize);    % STA device configuration
-    
-    % Create Nodes
-    apNode = wlanNode(Name="AP", Position=apPosition, DeviceConfig=apConfig, PHYAbstractionMethod=PHYAbstractionMethod, MACFrameAbstraction=MACFrameAbstraction);
-    staNodes = wlanNode(Name="STA"+(1:numSTAs), Position=staPositions, DeviceConfig=staConfig, PHYAbstractionMethod=PHYAbstractionMethod, MACFrameAbstraction=MACFrameAbstraction);
-        
-    % Create WLAN Network
-    nodes = [apNode staNodes];
-
-    % Verify configuration
-    hCheckWLANNodesConfiguration(nodes);
-
-    % Associate Stations
-    associateStations(apNode, staNodes);
-
-    % --[Configure External Application Traffic]--
-    for i = 1:numSTAs
-        % Uplink (STA to AP)
-        trafficDown = networkTrafficOnOff( ...
-            DataRate=(arrivalRate * packetSize * 8)/1000, ...
-            PacketSize=packetSize, ...
-            OnTime=Inf, OffTime=0);
-        addTrafficSource(apNode, trafficDown, DestinationNode=staNodes(i), AccessCategory=0);
+    scenarioKey = struct(Position=staPositions, PHYAbstraction=options.PHYAbstraction, PERTableFile=options.PERTableFile, ...
+        Seed=options.Seed, Substream=options.Substream);
+    useBatch = ~isempty(options.Batch);
+    useCheckpoint = strlength(options.CheckpointFile) > 0;
+    if useCheckpoint && useBatch
+        error("simulate_simple:CheckpointWithBatch", "CheckpointFile cannot be used with Batch.");
     end
+    % A warm start restores the nodes, the traffic and the channel from the
+    % snapshot, so nothing is built
+    useSnapshot = useCheckpoint && isfile(options.CheckpointFile);
+    if useSnapshot
+        [networkSimulator, snapshotData] = wirelessNetworkSimulator.restore(options.CheckpointFile);
+        runKey = {arrivalRate, staPositions, options.Seed, options.Substream, options.PHYAbstraction};
+        snapshotKey = {NaN, NaN, NaN, NaN, ""};
+        if all(isfield(snapshotData, ["Rate" "Position" "Seed" "Substream" "PHYAbstraction"]))
+            snapshotKey = {snapshotData.Rate, snapshotData.Position, snapshotData.Seed, ...
+                snapshotData.Substream, snapshotData.PHYAbstraction};
+        end
+        if ~isequal(snapshotKey, runKey)
+            error("simulate_simple:CheckpointMismatch", "Checkpoint %s was taken with another rate, position, seed, substream or PHY abstraction.", options.CheckpointFile);
+        end
+        nodes = snapshotData.Nodes;
+        apNode = nodes(1);
+        staNodes = nodes(2:end);
+    else
+        % Set the seed to 1 : affects backoff counter selection (L2), packet reception success (L1)
+        % Sweep tasks use independent substreams of the same seed. Seeded
+        % before the build or the fork, so a forked run draws the same
+        % numbers as a new build
+        rng(options.Seed, "combRecursive");
+        globalStream = RandStream.getGlobalStream;
+        globalStream.Substream = options.Substream;
+        if useBatch
+            % Fork the topology built once by the batch
+            [networkSimulator, scenario] = fork(options.Batch, scenarioKey);
+        else
+            networkSimulator = wirelessNetworkSimulator.init;
+            scenario = build_simple_scenario(networkSimulator, scenarioKey);
+        end
+    end
+
+    if ~useSnapshot
+        nodes = scenario.Nodes;
+        apNode = scenario.AP;
+        staNodes = scenario.STAs;
+        numSTAs = numel(staNodes);
 
-    % Wireless Channel
-        % The 802.11n channel object uses a filtered Gaussian noise model in which 
-        % ...the path delays, powers, angular spread, angles of arrival, and angles of departure 
-        % ...are determined empirically. The specific modeling approach is described in [1]. 
-        % TransmitReceiveDistance is used to compute the path loss, and to determine whether the channel has 
-        % ...a line of sight (LOS) or non line of sight (NLOS) condition. The path loss 
-        % ...and standard deviation of shadow fading loss depend on the separation between the transmitter and the receiver.
-        % Model-A : d_BP = 5m -> path_loss exponent = 3.5, shadow_fading std = 4 max_delay=0ns
-        % ...ref: https://fr.mathworks.com/help/wlan/ref/wlantgnchannel-system-object.html
-    tgnChan = wlanTGnChannel('DelayProfile','Model-A', ...
-                    'TransmitReceiveDistance',staPositions(1),...
-                    'LargeScaleFadingEffect','Pathloss', ...    % 'None' (default) | 'Pathloss' | 'Shadowing' | 'Pathloss and shadowing'
-                    'ChannelFiltering', false, ...
-                    'NumSamples', 80, ...
-                    'EnvironmentalSpeed', 0);   % Speed of the scatterers (diffuseurs : batiments, vehicules, etc.) in km/h
-    channel = hSLSTGaxMultiFrequencySystemChannel(nodes, tgnChan);
-    addChannelModel(networkSimulator, channel.ChannelFcn);
+        % --[Configure External Application Traffic]--
+        for i = 1:numSTAs
+            % Uplink (STA to AP)
+            trafficDown = networkTrafficOnOff( ...
+                DataRate=(arrivalRate * packetSize * 8)/1000, ...
+                PacketSize=packetSize, ...
+                OnTime=Inf, OffTime=0);
+            addTrafficSource(apNode, trafficDown, DestinationNode=staNodes(i), AccessCategory=0);
+        end
+    end
 
+    % --[Warm Start]--
+    if useCheckpoint && ~useSnapshot
+        if options.CheckpointTime <= 0 || options.CheckpointTime >= simulationTime
+            error("simulate_simple:InvalidCheckpointTime", "CheckpointTime must be between 0 and the simulation duration.");
+        end
+        addNodes(networkSimulator, nodes);
+        run(networkSimulator, options.CheckpointTime);
+        checkpoint(networkSimulator, options.CheckpointFile, struct(Nodes=nodes, Rate=arrivalRate, Position=staPositions, ...
+            Seed=options.Seed, Substream=options.Substream, PHYAbstraction=options.PHYAbstraction));
+    end
 
     % --[Packet Capture]--
     if capturePacketsFlag
-        capturePacketsObj = hExportWLANPackets(nodes);
+        capturePacketsObj = hExportWLANPackets(nodes, Streaming=true, SnapLength=options.CaptureSnapLength);
     end
 
     % --[Simulation and Results]--
@@ -111,12 +187,20 @@ function simulate_simple(staPosition, rate, simulationDuration)
     if enableNodePerformancePlot
         performancePlotObj = hVisualizePerformance(nodes, simulationTime);
     end
+    % Count what is exported: latency at STA1 and queueing delay at the AP
+    metricsObj = hHeadlessMetrics(staNodes(1), TxNodes=apNode);
 
     % Run the simulator
-    addNodes(networkSimulator, nodes);
-    run(networkSimulator, simulationTime);
+    if useCheckpoint
+        resume(networkSimulator, simulationTime);
+    else
+        if ~useBatch
+            addNodes(networkSimulator, nodes);
+        end
+        run(networkSimulator, simulationTime);
+    end
 
-    % Delete PCAP objects
+    % Delete PCAP objects, which flushes the buffered frames
     if capturePacketsFlag
         delete(capturePacketsObj.PCAPObjList);
     end
@@ -128,23 +212,43 @@ function simulate_simple(staPosition, rate, simulationDuration)
     nbReceivedPackets = "" + stasStats(1).App.ReceivedPackets;
 
     % Retrieve Performance Metrics
-    avgLatency = performancePlotObj.getAveragePacketLatency();
-    % packetLoss = performancePlotObj.getPacketLossRatio();
-    throughput = performancePlotObj.getThroughput();
+    if enableNodePerformancePlot
+        avgLatency = performancePlotObj.getAveragePacketLatency();
+        % packetLoss = performancePlotObj.getPacketLossRatio();
+        throughput = performancePlotObj.getThroughput();
+        staLatency = avgLatency(2,2);
+        apThroughput = throughput(1,2);
+    else
+        staLatency = metricsObj.averagePacketLatency(staNodes(1));
+        apThroughput = metricsObj.throughput(apNode, simulationTime);
+    end
 
     % Store Results
-    resultRow = [arrivalRate, simulationTime, "AP->STA1", nbSentPackets, nbReceivedPackets, avgLatency(2,2), throughput(1,2)];
+    resultRow = [arrivalRate, simulationTime, "AP->STA1", nbSentPackets, nbReceivedPackets, staLatency, apThroughput];
 
     % Define Output File
-    filename = '~/Documents/digital_twins/metrics/matlab_results.csv';
+    filename = options.ResultsFile;
 
     % Check if file exists, append data or create with headers
-    if isfile(filename)
+    if strlength(filename) == 0
+        % Only return the result row
+    elseif isfile(filename)
         writematrix(resultRow, filename, 'WriteMode', 'append');
     else
         headers = ["Arrival Rate (pps)", "Simulation Duration (s)", "Flow Direction", "Packets Sent", "Packets Received", "Average Delay (s)", "Throughput"];
         writematrix([headers; resultRow], filename);
     end
+    if strlength(options.StoreFile) > 0
+        append_results_store(options.StoreFile, resultRow);
+    end
+
+    % Tail latency
+    quantiles = [0.5 0.9 0.99 0.999];
+    quantileRow = [metricsObj.latencyQuantiles(staNodes(1), quantiles) ...
+        metricsObj.queueingDelayQuantiles(apNode, quantiles)];
+    if strlength(options.QuantilesFile) > 0
+        append_latency_quantiles(options.QuantilesFile, resultRow, quantileRow);
+    end
 
     disp(['Simulation completed for Arrival Rate: ', num2str(arrivalRate)]);
 end
@@ -0,0 +1,43 @@
+function [report, passed] = validate_phy_abstraction(staPosition, referenceFile, options)
+    % [REPORT, PASSED] = validate_phy_abstraction(STAPOSITION, REFERENCEFILE)
+    % re-runs each row of the full-PHY results file REFERENCEFILE, in the
+    % simulate_simple CSV format, with the calibrated PHY abstraction and the
+    % STA at STAPOSITION. REPORT is a table with the reference and abstracted
+    % packets received, latency and throughput of each row, and their
+    % relative errors. PASSED is true if all the relative errors are within
+    % the tolerance.
+    %
+    % validate_phy_abstraction(..., RelativeTolerance=T, PERTableFile=F)
+    % overrides the tolerance (default 0.05) and the PER table file (default
+    % "phyAbstractionTable.mat").
+    arguments
+        staPosition
+        referenceFile (1,1) string = "~/Documents/digital_twins/metrics/matlab_results.csv"
+        options.RelativeTolerance (1,1) double {mustBePositive} = 0.05
+        options.PERTableFile (1,1) string = "phyAbstractionTable.mat"
+    end
+
+    % Columns: rate, duration, flow, sent, received, latency, throughput
+    reference = readmatrix(referenceFile, 'OutputType', 'string', 'NumHeaderLines', 1);
+    reference = unique(reference, 'rows', 'stable');
+    numRuns = size(reference, 1);
+    metrics = ["Received" "Latency" "Throughput"];
+    referenceValues = str2double(reference(:, 5:7));
+    abstractedValues = zeros(numRuns, 3);
+
+    for k = 1:numRuns
+        resultRow = simulate_simple(staPosition, reference(k, 1), reference(k, 2), ...
+            Headless=true, ResultsFile="", PHYAbstraction="calibrated", PERTableFile=options.PERTableFile);
+        abstractedValues(k, :) = str2double(resultRow(5:7));
+    end
+
+    relativeErrors = abs(abstractedValues - referenceValues)./max(abs(referenceValues), eps);
+    report = table(str2double(reference(:, 1)), str2double(reference(:, 2)), ...
+        'VariableNames', ["ArrivalRate" "Duration"]);
+    for i = 1:numel(metrics)
+        report.("Reference" + metrics(i)) = referenceValues(:, i);
+        report.("Abstracted" + metrics(i)) = abstractedValues(:, i);
+        report.(metrics(i) + "Error") = relativeErrors(:, i);
+    end
+    passed = all(relativeErrors <= options.RelativeTolerance, 'all');
+end
@@ -97,6 +97,73 @@ classdef interferenceBuffer < comm.internal.ConfigBase & handle
         %to consider it as interference. This value depends on the
         %MinTimeOverlap property
         MinTimeOverlapThreshold
+
+        %PacketKeys Array of unique keys that identify the packet currently
+        % stored in each element of the 'PacketBuffer'
+        PacketKeys = []
+
+        %PacketBuckets Array indicating the center frequency bucket of each
+        % packet in the PacketBuffer
+        PacketBuckets = []
+
+        %NextPacketKey Key assigned to the next packet added to the buffer
+        NextPacketKey = 1
+
+        %MaxPacketDuration Longest duration of all the packets added to the
+        % buffer
+        MaxPacketDuration = 0
+
+        %BucketFrequencies Center frequency of each bucket in the interval
+        % index
+        BucketFrequencies = zeros(0, 1)
+
+        %BucketEntries Cell array of interval index entries, one element
+        % per bucket. Each element is a 3-by-N matrix of [StartTime; buffer
+        % index; packet key] columns sorted by start time. Columns whose
+        % packet is no longer stored are skipped by the queries and
+        % dropped lazily.
+        BucketEntries = cell(0, 1)
+
+        %BucketCount Number of used columns in each element of BucketEntries
+        BucketCount = zeros(0, 1)
+
+        %BucketHead Index of the first column of each bucket that is not
+        % yet dropped
+        BucketHead = zeros(0, 1)
+
+        %BucketNumPackets Number of active packets in each bucket
+        BucketNumPackets = zeros(0, 1)
+
+        %BucketMaxDuration Longest duration of the active packets in each
+        % bucket. Bounds the start times searched by the overlap queries.
+        BucketMaxDuration = zeros(0, 1)
+
+        %BucketMaxBandwidth Widest bandwidth of the active packets in each
+        % bucket
+        BucketMaxBandwidth = zeros(0, 1)
+
+        %WaveformCache Cell array containing the waveform of each packet in
+        % the PacketBuffer, resampled and shifted in frequency for the most
+        % recent resultant waveform query
+        WaveformCache = {}
+
+        %WaveformCacheKeys Array of [packet key, sample rate, center
+        % frequency] rows identifying each element of the WaveformCache
+        WaveformCacheKeys = []
+
+        %RunningQuery Start time, end time, center frequency, sample rate and
+        % number of receive antennas of the most recent combined waveform
+        RunningQuery = []
+
+        %RunningKeys Keys of the packets in the most recent combined waveform
+        RunningKeys = []
+
+        %RunningIndices Buffer indices of the packets in the most recent
+        % combined waveform
+        RunningIndices = []
+
+        %RunningWaveform Most recent combined waveform
+        RunningWaveform = []
     end
 
     properties(Hidden)
@@ -133,6 +200,10 @@ classdef interferenceBuffer < comm.internal.ConfigBase & handle
             % Initialize the properties
             obj.IsActive = false(obj.BufferSize, 1);
             obj.PacketEndTimes = -1 * ones(obj.BufferSize, 1);
+            obj.PacketKeys = zeros(obj.BufferSize, 1);
+            obj.PacketBuckets = zeros(obj.BufferSize, 1);
+            obj.WaveformCache = cell(obj.BufferSize, 1);
+            obj.WaveformCacheKeys = zeros(obj.BufferSize, 3);
 
             obj.ACPRObject = comm.ACPR('MainChannelPowerOutputPort', true,...
                 'AdjacentChannelPowerOutputPort', false, 'SampleRate', obj.SampleRate);
@@ -195,6 +266,9 @@ classdef interferenceBuffer < comm.internal.ConfigBase & handle
             obj.IsActive(bufferIdx) = true;
             obj.PacketEndTimes(bufferIdx) = packet.StartTime + packet.Duration; % End time of the packet
             obj.PacketBuffer(bufferIdx) = packet;
+
+            % Add the packet to the interval index
+            indexPacket(obj, bufferIdx, packet);
         end
 
         function [rxWaveform, numPackets, sampleRate] = resultantWaveform(obj, startTime, endTime, varargin)
@@ -357,8 +431,11 @@ classdef interferenceBuffer < comm.internal.ConfigBase & handle
 
             [centerFrequency, bandwidth] = validateInputs(obj, varargin);
 
-            activeSignalIdx = obj.IsActive & ((obj.PacketEndTimes - currentTime) > obj.MinTimeOverlapThreshold);
+            activeSignalIdx = activePackets(obj, currentTime);
             currentPower = -Inf;
+            if isempty(activeSignalIdx)
+                return;
+            end
             minEndTime = min(obj.PacketEndTimes(activeSignalIdx));
 
             [activePacketIdxs, numPackets, acprRequiredFlag] = getOverlappingPackets(obj, currentTime, minEndTime, centerFrequency, bandwidth);
@@ -433,7 +510,7 @@ classdef interferenceBuffer < comm.internal.ConfigBase & handle
                     {'scalar', 'real', 'nonnegative', 'finite'}, mfilename, 'currentTime');
             end
 
-            activeSignalIdx = obj.IsActive & ((obj.PacketEndTimes - currentTime) > obj.MinTimeOverlapThreshold);
+            activeSignalIdx = activePackets(obj, currentTime);
             t =  min(obj.PacketEndTimes(activeSignalIdx)) - currentTime;
             if isempty(t)
                 t = inf;
@@ -484,8 +561,7 @@ classdef interferenceBuffer < comm.internal.ConfigBase & handle
                 validateattributes(bufferIdx, {'numeric'}, ...
                     {'vector', 'integer', 'positive', '<=', numel(obj.IsActive)}, mfilename, 'bufferIdx');
             end
-            obj.IsActive(bufferIdx) = false;
-            obj.PacketEndTimes(bufferIdx) = -1;
+            deactivatePackets(obj, bufferIdx);
         end
 
     end
@@ -494,93 +570,144 @@ classdef interferenceBuffer < comm.internal.ConfigBase & handle
         function rxWaveform = combineWaveforms(obj, startTime, endTime, centerFrequency, packetIndices, sampleRate)
             %combineWaveforms Return the combined waveform
 
-            numPackets = numel(packetIndices);
+            packetKeys = obj.PacketKeys(packetIndices);
+            packetKeys = packetKeys(:);
+            nRxAnts = size(obj.PacketBuffer(packetIndices(1)).Data, 2);
+            waveformQuery = [startTime endTime centerFrequency sampleRate nRxAnts];
+
+            % Update the running waveform of the previous query for the same
+            % reception period by subtracting the packets that are no longer
+            % overlapping and adding the new packets. The packets that are
+            % subtracted must still be stored in the buffer.
+            if isequal(waveformQuery, obj.RunningQuery)
+                removedIdx = find(~ismember(obj.RunningKeys, packetKeys));
+                removedPacketIdxs = obj.RunningIndices(removedIdx);
+                if all(obj.PacketKeys(removedPacketIdxs) == obj.RunningKeys(removedIdx))
+                    rxWaveform = obj.RunningWaveform;
+                    for idx = 1:numel(removedPacketIdxs)
+                        rxWaveform = accumulateWaveform(obj, rxWaveform, startTime, endTime, centerFrequency, removedPacketIdxs(idx), sampleRate, -1);
+                    end
+                    addedPacketIdxs = packetIndices(~ismember(packetKeys, obj.RunningKeys));
+                    for idx = 1:numel(addedPacketIdxs)
+                        rxWaveform = accumulateWaveform(obj, rxWaveform, startTime, endTime, centerFrequency, addedPacketIdxs(idx), sampleRate, 1);
+                    end
+                    obj.RunningKeys = packetKeys;
+                    obj.RunningIndices = packetIndices(:);
+                    obj.RunningWaveform = rxWaveform;
+                    return;
+                end
+            end
+
             % Initialize the waveform
-            receivedPackets = obj.PacketBuffer(packetIndices);
             duration = endTime - startTime;
-            nRxAnts = size(receivedPackets(1).Data, 2);
             waveformLength = round(duration * sampleRate);
             rxWaveform = complex(zeros(waveformLength, nRxAnts));
 
-            for idx = 1:numPackets
-                packet = receivedPackets(idx);
+            for idx = 1:numel(packetIndices)
+                rxWaveform = accumulateWaveform(obj, rxWaveform, startTime, endTime, centerFrequency, packetIndices(idx), sampleRate, 1);
+            end
 
-                if ~obj.DisableValidation
-                    % Verify all the packets are from full phy (Abstraction = false)
-                    coder.internal.assert(~packet.Abstraction, 'wirelessnetwork:interferenceBuffer:MethodNotApplicable')
+            obj.RunningQuery = waveformQuery;
+            obj.RunningKeys = packetKeys;
+            obj.RunningIndices = packetIndices(:);
+            obj.RunningWaveform = rxWaveform;
+        end
 
-                    % Verify that the number of columns in packet.Data
-                    % field must be same for all the packets
-                    coder.internal.assert(nRxAnts == size(packet.Data, 2), 'wirelessnetwork:interferenceBuffer:InvalidWaveformSize')
-                end
+        function rxWaveform = accumulateWaveform(obj, rxWaveform, startTime, endTime, centerFrequency, packetIdx, sampleRate, scale)
+            %accumulateWaveform Add the overlapping part of the packet
+            %waveform, multiplied by scale, to the resultant waveform
 
-                % Calculate the number of overlapping samples
-                overlapStartTime = max(startTime, packet.StartTime);
-                overlapEndTime = min(endTime, packet.StartTime + packet.Duration);
-                % Using ceil/floor results one extra/less sample. So, using
-                % the round helps to consider an extra sample only if it
-                % overlaps with signal of interest for more than half of the
-                % sample period.
-                numSOIOverlapSamples = round((overlapEndTime - overlapStartTime) * sampleRate);
-                numInterfererOverlapSamples = round((overlapEndTime - overlapStartTime) * packet.SampleRate);
-                if numInterfererOverlapSamples == 0 || numSOIOverlapSamples == 0
-                    continue;
-                end
-                
-                % Calculate the overlapping start and end index of
-                % the resultant waveform time-domain samples
-                soiStartIdx = round((overlapStartTime - startTime) * sampleRate) + 1;
-                soiEndIdx = soiStartIdx + numSOIOverlapSamples - 1;
-                % Overlapping end index should not exceed the resultant waveform length
-                if soiEndIdx > waveformLength
-                    numSOIOverlapSamples = numSOIOverlapSamples - (soiEndIdx - waveformLength);
-                    soiEndIdx = waveformLength;
-                end
+            packet = obj.PacketBuffer(packetIdx);
+            [waveformLength, nRxAnts] = size(rxWaveform);
 
-                % Calculate the overlapping start and end index of
-                % the interferer waveform time-domain samples
-                iStartIdx = round((overlapStartTime - packet.StartTime) * packet.SampleRate) + 1;
-                iEndIdx = iStartIdx + numInterfererOverlapSamples - 1;
-                interfererWaveform = zeros(numSOIOverlapSamples, nRxAnts);
-
-                waveform = packet.Data;
-                numPadding = 0;
-                packetWaveformLength = size(waveform, 1);
-                % Overlapping end index should not exceed the interfering waveform length
-                if iEndIdx > packetWaveformLength
-                    numPadding = iEndIdx - packetWaveformLength;
-                    iEndIdx = packetWaveformLength;
-                end
-                if numSOIOverlapSamples ~= numInterfererOverlapSamples
-                    [L, M] = rat(sampleRate/packet.SampleRate);
-                    resampledWaveform = resample(waveform(iStartIdx:iEndIdx, :), L, M);
-                    % When number of rows in the input is 1, resample function returns row vector .
-                    if numInterfererOverlapSamples == 1
-                        numRows = min(size(resampledWaveform, 2)/nRxAnts, numSOIOverlapSamples);
-                        resampledWaveform = reshape(resampledWaveform, [numRows nRxAnts]);
-                    end
-                    if size(resampledWaveform, 1) < numSOIOverlapSamples
-                        numSOIOverlapSamples = size(resampledWaveform, 1);
-                    end
-                    interfererWaveform(1:numSOIOverlapSamples, :) = resampledWaveform(1:numSOIOverlapSamples, :);
-                else
-                    interfererWaveform = [waveform(iStartIdx:iEndIdx,:); zeros(numPadding, nRxAnts)];
-                end
+            if ~obj.DisableValidation
+                % Verify all the packets are from full phy (Abstraction = false)
+                coder.internal.assert(~packet.Abstraction, 'wirelessnetwork:interferenceBuffer:MethodNotApplicable')
+
+                % Verify that the number of columns in packet.Data
+                % field must be same for all the packets
+                coder.internal.assert(nRxAnts == size(packet.Data, 2), 'wirelessnetwork:interferenceBuffer:InvalidWaveformSize')
+            end
+
+            % Calculate the number of overlapping samples
+            overlapStartTime = max(startTime, packet.StartTime);
+            overlapEndTime = min(endTime, packet.StartTime + packet.Duration);
+            % Using ceil/floor results one extra/less sample. So, using
+            % the round helps to consider an extra sample only if it
+            % overlaps with signal of interest for more than half of the
+            % sample period.
+            numSOIOverlapSamples = round((overlapEndTime - overlapStartTime) * sampleRate);
+            numInterfererOverlapSamples = round((overlapEndTime - overlapStartTime) * packet.SampleRate);
+            if numInterfererOverlapSamples == 0 || numSOIOverlapSamples == 0
+                return;
+            end
+
+            % Calculate the overlapping start and end index of
+            % the resultant waveform time-domain samples
+            soiStartIdx = round((overlapStartTime - startTime) * sampleRate) + 1;
+            soiEndIdx = soiStartIdx + numSOIOverlapSamples - 1;
+            % Overlapping end index should not exceed the resultant waveform length
+            if soiEndIdx > waveformLength
+                numSOIOverlapSamples = numSOIOverlapSamples - (soiEndIdx - waveformLength);
+                soiEndIdx = waveformLength;
+            end
+
+            % Calculate the overlapping start and end index of the
+            % interferer waveform time-domain samples, at the resultant
+            % sample rate
+            waveform = cachedWaveform(obj, packetIdx, centerFrequency, sampleRate);
+            iStartIdx = round((overlapStartTime - packet.StartTime) * sampleRate) + 1;
+            % Overlapping end index should not exceed the interfering waveform length
+            iEndIdx = min(iStartIdx + numSOIOverlapSamples - 1, size(waveform, 1));
+            numPadding = numSOIOverlapSamples - max(iEndIdx - iStartIdx + 1, 0);
+            interfererWaveform = [waveform(iStartIdx:iEndIdx, :); zeros(numPadding, nRxAnts)];
+
+            % The cached waveform is shifted in frequency relative to the
+            % packet start. Align the phase to the start of the overlap.
+            frequencyOffset = (-centerFrequency + packet.CenterFrequency);
+            if frequencyOffset ~= 0 && iStartIdx > 1
+                interfererWaveform = interfererWaveform .* exp(-1i*2*pi*frequencyOffset*(iStartIdx-1)/sampleRate);
+            end
+
+            % Combine the time-domain samples
+            rxWaveform(soiStartIdx:soiEndIdx, 1:nRxAnts) = ...
+                rxWaveform(soiStartIdx:soiEndIdx, 1:nRxAnts) + ...
+                scale*interfererWaveform(:,1:nRxAnts);
+        end
+
+        function waveform = cachedWaveform(obj, packetIdx, centerFrequency, sampleRate)
+            %cachedWaveform Return the waveform of the packet stored in the
+            %specified buffer index, resampled to the sample rate and
+            %shifted to the center frequency
+
+            cacheKey = [obj.PacketKeys(packetIdx) sampleRate centerFrequency];
+            if isequal(obj.WaveformCacheKeys(packetIdx, :), cacheKey)
+                waveform = obj.WaveformCache{packetIdx};
+                return;
+            end
 
-                % Shift the interfering waveform in frequency if the
-                % center frequency does not match with required center
-                % frequency
-                frequencyOffset = (-centerFrequency + packet.CenterFrequency);
-                if frequencyOffset ~= 0
-                    t = ((0:size(interfererWaveform,1)-1) / sampleRate)';
-                    interfererWaveform = interfererWaveform .* exp(1i*2*pi*frequencyOffset*t);
+            packet = obj.PacketBuffer(packetIdx);
+            waveform = packet.Data;
+            if sampleRate ~= packet.SampleRate
+                [L, M] = rat(sampleRate/packet.SampleRate);
+                waveform = resample(waveform, L, M);
+                % When number of rows in the input is 1, resample function returns row vector
+                if size(packet.Data, 1) == 1
+                    waveform = reshape(waveform, [], size(packet.Data, 2));
                 end
+            end
 
-                % Combine the time-domain samples
-                rxWaveform(soiStartIdx:soiEndIdx, 1:nRxAnts) = ...
-                    rxWaveform(soiStartIdx:soiEndIdx, 1:nRxAnts) + ...
-                    interfererWaveform(:,1:nRxAnts);
+            % Shift the interfering waveform in frequency if the
+            % center frequency does not match with required center
+            % frequency
+            frequencyOffset = (-centerFrequency + packet.CenterFrequency);
+            if frequencyOffset ~= 0
+                t = ((0:size(waveform,1)-1) / sampleRate)';
+                waveform = waveform .* exp(1i*2*pi*frequencyOffset*t);
             end
+
+            obj.WaveformCache{packetIdx} = waveform;
+            obj.WaveformCacheKeys(packetIdx, :) = cacheKey;
         end
 
         function [packetIdxList, numPackets, acprRequiredFlag] = getOverlappingPackets(obj, startTime, endTime, centerFrequency, bandwidth)
@@ -588,55 +715,212 @@ classdef interferenceBuffer < comm.internal.ConfigBase & handle
             %packets, and a flag which indicates all the overlapping
             %packets are of same center frequency and bandwidth or not
 
-            % Find the active packets
             minTimeOverlapThreshold = obj.MinTimeOverlapThreshold;
-            packetIndices = find(obj.IsActive & ((obj.PacketEndTimes - startTime) > minTimeOverlapThreshold));
-            numActivePackets = numel(packetIndices);
-            packetIdxList = zeros(numActivePackets, 1);
-            numPackets = 0;
-            channelCollisionFlag = false;
+            packetIdxList = zeros(0, 1);
             acprRequiredFlag = false;
 
             % Filter the overlapping packets based on InterferenceFidelity value
             soiStartFrequency = centerFrequency - bandwidth/2;
             soiEndFrequency = centerFrequency + bandwidth/2;
-            for idx = 1:numActivePackets
+            for bucketIdx = 1:numel(obj.BucketFrequencies)
+                packetFrequency = obj.BucketFrequencies(bucketIdx);
+
+                % The packets of a bucket which cannot overlap in frequency
+                % only affect the ACPR flag
+                maxBandwidth = obj.BucketMaxBandwidth(bucketIdx);
+                if acprRequiredFlag && obj.InterferenceFidelity == 0 && ...
+                        min(soiEndFrequency, packetFrequency + maxBandwidth/2) - max(soiStartFrequency, packetFrequency - maxBandwidth/2) <= 0
+                    continue;
+                end
 
-                % Get the packet
-                packet = obj.PacketBuffer(packetIndices(idx));
+                % Get the active packets of the bucket that can overlap
+                % with the given time period
+                candidateIdx = bucketPackets(obj, bucketIdx, startTime, endTime);
+                if isempty(candidateIdx)
+                    continue;
+                end
+                packets = obj.PacketBuffer(candidateIdx);
+                packetEndTimes = obj.PacketEndTimes(candidateIdx);
+                packetBandwidths = [packets.Bandwidth]';
 
                 % Find the active packets between the given time period
-                if (min(endTime, packet.StartTime+packet.Duration) - max(startTime, packet.StartTime) > minTimeOverlapThreshold)
-                    if obj.InterferenceFidelity == 0 % Overlap in frequency and time
-                        % Check the packet overlap in frequency
-                        if min(soiEndFrequency, packet.CenterFrequency + packet.Bandwidth/2)- max(soiStartFrequency, packet.CenterFrequency - packet.Bandwidth/2) > 0
-                            channelCollisionFlag = true;
-                        end
-                    end
-                   % If there is partial overlap in frequency or if the interference fidelity level is high
-                    if channelCollisionFlag || obj.InterferenceFidelity == 1
-                        numPackets = numPackets + 1;
-                        packetIdxList(numPackets) = packetIndices(idx);
-                        channelCollisionFlag = false;
-                    end
-                    % Check whether all the packets are of different center frequency or
-                    % bandwidth
-                    if packet.CenterFrequency ~= centerFrequency || packet.Bandwidth ~= bandwidth
-                        acprRequiredFlag = true;
-                    end
+                overlapFlags = ((packetEndTimes - startTime) > minTimeOverlapThreshold) & ...
+                    (min(endTime, packetEndTimes) - max(startTime, [packets.StartTime]') > minTimeOverlapThreshold);
+
+                % Check whether all the packets are of different center frequency or
+                % bandwidth
+                if any(overlapFlags & (packetFrequency ~= centerFrequency | packetBandwidths ~= bandwidth))
+                    acprRequiredFlag = true;
                 end
+
+                if obj.InterferenceFidelity == 0 % Overlap in frequency and time
+                    % Check the packet overlap in frequency
+                    overlapFlags = overlapFlags & ...
+                        (min(soiEndFrequency, packetFrequency + packetBandwidths/2) - max(soiStartFrequency, packetFrequency - packetBandwidths/2) > 0);
+                end
+                packetIdxList = [packetIdxList; candidateIdx(overlapFlags)]; %#ok<AGROW>
             end
-            packetIdxList = packetIdxList(1:numPackets);
+
+            % Return the packets in the order of their buffer indices
+            packetIdxList = sort(packetIdxList);
+            numPackets = numel(packetIdxList);
+        end
+
+        function bufferIdx = activePackets(obj, currentTime)
+            %activePackets Return the buffer indices of the active packets
+            %which end after the specified time
+
+            bufferIdx = zeros(0, 1);
+            for bucketIdx = 1:numel(obj.BucketFrequencies)
+                candidateIdx = bucketPackets(obj, bucketIdx, currentTime, Inf);
+                bufferIdx = [bufferIdx; candidateIdx((obj.PacketEndTimes(candidateIdx) - currentTime) > obj.MinTimeOverlapThreshold)]; %#ok<AGROW>
+            end
+        end
+
+        function bufferIdx = bucketPackets(obj, bucketIdx, startTime, endTime)
+            %bucketPackets Return the buffer indices of the active packets
+            %in the bucket which start before the end time and can end
+            %after the start time
+
+            entries = obj.BucketEntries{bucketIdx};
+            numEntries = obj.BucketCount(bucketIdx);
+
+            % A packet ending after the start time started at most the
+            % longest duration of the bucket earlier. The minimum overlap
+            % margin absorbs the rounding of the packet end times.
+            firstIdx = lowerBound(entries, obj.BucketHead(bucketIdx), numEntries, ...
+                startTime - obj.BucketMaxDuration(bucketIdx) - obj.MinTimeOverlap);
+            lastIdx = lowerBound(entries, firstIdx, numEntries, endTime) - 1;
+
+            % Skip the entries of the packets which are no longer stored
+            bufferIdx = entries(2, firstIdx:lastIdx)';
+            packetKeys = entries(3, firstIdx:lastIdx)';
+            bufferIdx = bufferIdx(obj.IsActive(bufferIdx) & (obj.PacketKeys(bufferIdx) == packetKeys));
+        end
+
+        function indexPacket(obj, bufferIdx, packet)
+            %indexPacket Add the packet stored in the specified buffer index
+            %to the interval index
+
+            % Find the bucket of the packet center frequency
+            bucketIdx = find(obj.BucketFrequencies == packet.CenterFrequency, 1);
+            if isempty(bucketIdx)
+                bucketIdx = numel(obj.BucketFrequencies) + 1;
+                obj.BucketFrequencies(bucketIdx, 1) = packet.CenterFrequency;
+                obj.BucketEntries{bucketIdx, 1} = zeros(3, obj.BufferSize);
+                obj.BucketCount(bucketIdx, 1) = 0;
+                obj.BucketHead(bucketIdx, 1) = 1;
+                obj.BucketNumPackets(bucketIdx, 1) = 0;
+                obj.BucketMaxDuration(bucketIdx, 1) = 0;
+                obj.BucketMaxBandwidth(bucketIdx, 1) = 0;
+            end
+
+            packetKey = obj.NextPacketKey;
+            obj.NextPacketKey = packetKey + 1;
+            obj.PacketKeys(bufferIdx) = packetKey;
+            obj.PacketBuckets(bufferIdx) = bucketIdx;
+            obj.MaxPacketDuration = max(obj.MaxPacketDuration, packet.Duration);
+            obj.BucketNumPackets(bucketIdx) = obj.BucketNumPackets(bucketIdx) + 1;
+            obj.BucketMaxDuration(bucketIdx) = max(obj.BucketMaxDuration(bucketIdx), packet.Duration);
+            obj.BucketMaxBandwidth(bucketIdx) = max(obj.BucketMaxBandwidth(bucketIdx), packet.Bandwidth);
+
+            % Double the bucket capacity when it is full
+            numEntries = obj.BucketCount(bucketIdx);
+            if numEntries == size(obj.BucketEntries{bucketIdx}, 2)
+                obj.BucketEntries{bucketIdx} = [obj.BucketEntries{bucketIdx} zeros(3, max(numEntries, 1))];
+            end
+
+            % Packets are normally added in the order of their start times.
+            % Otherwise, shift the later entries to keep the bucket sorted.
+            entryIdx = numEntries + 1;
+            headIdx = obj.BucketHead(bucketIdx);
+            if numEntries >= headIdx && obj.BucketEntries{bucketIdx}(1, numEntries) > packet.StartTime
+                entryIdx = lowerBound(obj.BucketEntries{bucketIdx}, headIdx, numEntries, packet.StartTime);
+                obj.BucketEntries{bucketIdx}(:, entryIdx+1:numEntries+1) = obj.BucketEntries{bucketIdx}(:, entryIdx:numEntries);
+            end
+            obj.BucketEntries{bucketIdx}(:, entryIdx) = [packet.StartTime; bufferIdx; packetKey];
+            obj.BucketCount(bucketIdx) = numEntries + 1;
+        end
+
+        function deactivatePackets(obj, bufferIdx)
+            %deactivatePackets Mark the packets stored in the specified
+            %buffer indices as inactive and drop them from the interval index
+
+            bufferIdx = unique(reshape(bufferIdx(obj.IsActive(bufferIdx)), [], 1));
+            obj.IsActive(bufferIdx) = false;
+            obj.PacketEndTimes(bufferIdx) = -1;
+            % Release the cached waveforms
+            obj.WaveformCache(bufferIdx) = {[]};
+            obj.WaveformCacheKeys(bufferIdx, :) = 0;
+            if isempty(bufferIdx)
+                return;
+            end
+
+            bucketIndices = obj.PacketBuckets(bufferIdx);
+            for idx = 1:numel(bucketIndices)
+                obj.BucketNumPackets(bucketIndices(idx)) = obj.BucketNumPackets(bucketIndices(idx)) - 1;
+            end
+            for bucketIdx = unique(bucketIndices)'
+                trimBucket(obj, bucketIdx);
+            end
+        end
+
+        function trimBucket(obj, bucketIdx)
+            %trimBucket Drop the entries of the inactive packets from the
+            %head of the bucket and compact the bucket
+
+            numPackets = obj.BucketNumPackets(bucketIdx);
+            if numPackets == 0
+                % Reset the empty bucket
+                obj.BucketCount(bucketIdx) = 0;
+                obj.BucketHead(bucketIdx) = 1;
+                obj.BucketMaxDuration(bucketIdx) = 0;
+                obj.BucketMaxBandwidth(bucketIdx) = 0;
+                return;
+            end
+
+            % Advance the head to the first active packet. Each entry is
+            % passed over once, which keeps the eviction cost constant per
+            % packet.
+            entries = obj.BucketEntries{bucketIdx};
+            numEntries = obj.BucketCount(bucketIdx);
+            headIdx = obj.BucketHead(bucketIdx);
+            while ~obj.IsActive(entries(2, headIdx)) || obj.PacketKeys(entries(2, headIdx)) ~= entries(3, headIdx)
+                headIdx = headIdx + 1;
+            end
+
+            % Move the remaining entries to the front of the bucket once
+            % most of them are inactive or most of the bucket is behind the
+            % head
+            entryIdx = headIdx:numEntries;
+            if numel(entryIdx) > 2*numPackets
+                entryIdx = entryIdx(obj.IsActive(entries(2, entryIdx)) & (obj.PacketKeys(entries(2, entryIdx)) == entries(3, entryIdx)'));
+            end
+            if numel(entryIdx) < numEntries - headIdx + 1 || headIdx > numEntries/2
+                liveEntries = entries(:, entryIdx);
+                % Release the shared copy before writing in place
+                entries = []; %#ok<NASGU>
+                obj.BucketEntries{bucketIdx}(:, 1:numel(entryIdx)) = liveEntries;
+                headIdx = 1;
+                numEntries = numel(entryIdx);
+            end
+            obj.BucketHead(bucketIdx) = headIdx;
+            obj.BucketCount(bucketIdx) = numEntries;
         end
 
         function removeObsoletePackets(obj, endTime)
             %removeObsoletePackets Remove the packets from the buffer which
             %have ended on or before the specified time
 
-            expiredSignalIdx = obj.IsActive & (obj.PacketEndTimes <= endTime);
-            if any(expiredSignalIdx)
-                obj.IsActive(expiredSignalIdx) = false;
-                obj.PacketEndTimes(expiredSignalIdx) = -1;
+            % Only the packets starting before the specified time can have
+            % ended
+            expiredSignalIdx = zeros(0, 1);
+            for bucketIdx = 1:numel(obj.BucketFrequencies)
+                candidateIdx = bucketPackets(obj, bucketIdx, -Inf, endTime);
+                expiredSignalIdx = [expiredSignalIdx; candidateIdx(obj.PacketEndTimes(candidateIdx) <= endTime)]; %#ok<AGROW>
+            end
+            if ~isempty(expiredSignalIdx)
+                deactivatePackets(obj, expiredSignalIdx);
             end
         end
 
@@ -644,7 +928,7 @@ classdef interferenceBuffer < comm.internal.ConfigBase & handle
             %autoResizePacketBuffer Return the next inactive buffer index after resizing the packet buffer
 
             % Remove the obsolete packets
-            maxDuration = max([obj.PacketBuffer.Duration obj.BufferCleanupTime]);
+            maxDuration = max(obj.MaxPacketDuration, obj.BufferCleanupTime);
             removeObsoletePackets(obj, currentTime-maxDuration);
 
              bufferIdx = find(~obj.IsActive, 1);
@@ -654,6 +938,10 @@ classdef interferenceBuffer < comm.internal.ConfigBase & handle
                  obj.BufferSize = obj.BufferSize * 2;
                  obj.IsActive = [obj.IsActive; false(prevSize, 1)];
                  obj.PacketEndTimes = [obj.PacketEndTimes; zeros(prevSize, 1)-1];
+                 obj.PacketKeys = [obj.PacketKeys; zeros(prevSize, 1)];
+                 obj.PacketBuckets = [obj.PacketBuckets; zeros(prevSize, 1)];
+                 obj.WaveformCache = [obj.WaveformCache; cell(prevSize, 1)];
+                 obj.WaveformCacheKeys = [obj.WaveformCacheKeys; zeros(prevSize, 3)];
                  obj.PacketBuffer = [obj.PacketBuffer; repmat(wirelessnetwork.internal.wirelessPacket,prevSize,1)];
                  bufferIdx = prevSize + 1;
              end
@@ -701,4 +989,20 @@ classdef interferenceBuffer < comm.internal.ConfigBase & handle
             end
         end
     end
+end
+
+function idx = lowerBound(entries, idx, lastIdx, value)
+%lowerBound Return the index of the first column in entries(:, idx:lastIdx)
+%whose start time is greater than or equal to the value. Returns lastIdx+1
+%if there is no such column.
+
+hiIdx = lastIdx + 1;
+while idx < hiIdx
+    midIdx = floor((idx + hiIdx)/2);
+    if entries(1, midIdx) < value
+        idx = midIdx + 1;
+    else
+        hiIdx = midIdx;
+    end
+end
 end
\ No newline at end of file
@@ -218,6 +218,15 @@ classdef (Abstract) wirelessNode < handle & comm.internal.ConfigBase
             % reset the ID counter before creating nodes in the simulation
              wirelessnetwork.internal.wirelessNode.generateID(0);
         end
+
+        function restoreIDCounter(count)
+            %restoreIDCounter Set the node ID counter
+            %
+            % restoreIDCounter(COUNT) Set the node ID counter to COUNT, so
+            % that the next node created gets the ID COUNT+1. Invoke this
+            % method after restoring nodes from a simulation snapshot
+             wirelessnetwork.internal.wirelessNode.generateID(count);
+        end
     end
 
     methods (Static, Access = private)
@@ -228,6 +237,8 @@ classdef (Abstract) wirelessNode < handle & comm.internal.ConfigBase
             % counter starts from 1
             %
             % generateID(0) Resets the node ID counter to 0
+            %
+            % generateID(COUNT) Sets the node ID counter to COUNT
 
             persistent count;
             if numel(varargin) == 0
@@ -238,7 +249,7 @@ classdef (Abstract) wirelessNode < handle & comm.internal.ConfigBase
                 end
                 varargout{1} = count;
             else
-                count = 0;
+                count = varargin{1};
             end
         end
     end
@@ -18,15 +18,20 @@ classdef wirelessNetworkSimulator < handle
     %
     %   init            - Create or reset the simulator object
     %   getInstance     - Get the simulator object
+    %   restore         - Restore the simulation state from a snapshot file
     %
     %   wirelessNetworkSimulator object methods:
     %
     %   addChannelModel - Add custom channel and path loss model
     %   addNodes        - Add nodes to the simulator
     %   run             - Run the simulation
+    %   resume          - Continue the simulation to a later end time
+    %   checkpoint      - Save the simulation state to a snapshot file
     %   scheduleAction  - Schedule an action to process at a specified
     %                     simulation time
     %   cancelAction    - Cancel a scheduled action
+    %   setReceivePowerThreshold - Skip packet distribution to receivers
+    %                     below a receive power threshold
     %
     %  Note: By default, the simulator supports single-input
     %  single-output (SISO) scenarios. A channel model must be added using <a href="matlab:help('wirelessNetworkSimulator/addChannelModel')">addChannelModel</a>
@@ -49,6 +54,12 @@ classdef wirelessNetworkSimulator < handle
 
         %Nodes Cell array of nodes added to the simulator
         Nodes = {}
+
+        %ReceivePowerThreshold Receive power threshold in dBm below which
+        %packets are not distributed to a receiver. To set this value, call
+        %the setReceivePowerThreshold object function. The default value is
+        %-Inf.
+        ReceivePowerThreshold = -Inf
     end
 
     properties (Access = protected)
@@ -62,6 +73,22 @@ classdef wirelessNetworkSimulator < handle
         %NodeNextInvokeTimes List of next invoke time of the nodes in network
         NodeNextInvokeTimes
 
+        %NodeHeap Binary min-heap of node indices ordered by next invoke time
+        %and then by node index
+        NodeHeap
+
+        %NodeHeapPosition Position of each node index in NodeHeap
+        NodeHeapPosition
+
+        %PairPathLoss Path loss in dB observed on each transmitter-receiver
+        %pair of node indices, NaN if not observed yet
+        PairPathLoss
+
+        %PairPathLossKey Transmitter position, receiver position and center
+        %frequency at which PairPathLoss was observed, one row per pair
+        %(transmitter index + (receiver index - 1) * number of nodes)
+        PairPathLossKey
+
         %TimeAdvanceActions List of actions to be performed on every time advance
         TimeAdvanceActions
 
@@ -83,9 +110,22 @@ classdef wirelessNetworkSimulator < handle
         %default channel model or custom channel model
         DefaultChannelModel = true
 
+        %PathLossFunction Function handle to the large scale loss of a link
+        %of the custom channel model, empty if not given
+        PathLossFunction = []
+
         %NewActionsAdded Flag to indicate whether new action is added during the
         %simuation
         NewActionsAdded = false
+
+        %LastRunTime Simulation time in seconds of the last iteration of the
+        %run loop
+        LastRunTime = 0
+
+        %NextRunTime Simulation time in seconds of the first iteration which
+        %was not run because it is after EndTime. A call to resume starts
+        %from this time.
+        NextRunTime = 0
     end
 
     methods(Static)
@@ -109,16 +149,51 @@ classdef wirelessNetworkSimulator < handle
 
             obj = wirelessNetworkSimulator.getState(0);
         end
+
+        function [obj, userData] = restore(fileName)
+            %restore Restore the simulation state from a snapshot file
+            %
+            %   [OBJ, USERDATA] = wirelessNetworkSimulator.restore(FILENAME) loads
+            %   the snapshot saved by <a href="matlab:help('wirelessNetworkSimulator/checkpoint')">checkpoint</a> in the MAT-file FILENAME. The
+            %   restored simulator object, OBJ, becomes the object returned by
+            %   getInstance, and the saved global random number stream becomes
+            %   the global stream again. USERDATA is the data passed to
+            %   checkpoint. Call <a href="matlab:help('wirelessNetworkSimulator/resume')">resume</a> to continue the simulation, or <a href="matlab:help('wirelessNetworkSimulator/run')">run</a> if the
+            %   snapshot was taken before the simulation was run.
+            %
+            %   Each call loads an independent copy of the simulation, so several
+            %   variants can be forked from one snapshot by restoring it once per
+            %   variant.
+
+            narginchk(1,1);
+            snapshot = load(fileName, "snapshot").snapshot;
+            obj = wirelessNetworkSimulator.getState(2, snapshot.Simulator);
+            RandStream.setGlobalStream(snapshot.RandomStream);
+            % New nodes must not reuse the IDs of the restored nodes
+            wirelessnetwork.internal.wirelessNode.restoreIDCounter(snapshot.NodeIDCounter);
+            userData = snapshot.UserData;
+        end
     end
 
     methods
-        function addChannelModel(obj, customChannelFcn)
+        function addChannelModel(obj, customChannelFcn, pathLossFcn)
             %addChannelModel Add custom channel and path loss model
             %
             %   addChannelModel(OBJ,CUSTOMCHANNELFCN) adds the function handle,
             %   CUSTOMCHANNELFCN, of a custom channel and path loss model for all the
             %   links in the simulation.
             %
+            %   addChannelModel(OBJ,CUSTOMCHANNELFCN,PATHLOSSFCN) also adds the
+            %   function handle, PATHLOSSFCN, of the large scale loss of the
+            %   channel, used with the receive power threshold. It has the
+            %   signature:
+            %     PL = pathLossFcn(RXINFO,TXPACKET)
+            %        PL is the loss in dB which CUSTOMCHANNELFCN applies to the
+            %        Power of every packet between the transmitter and the
+            %        receiver while neither moves, such as the path loss minus a
+            %        fixed shadow fading. Return NaN if the loss of the link may
+            %        change from packet to packet. See <a href="matlab:help('wirelessNetworkSimulator/setReceivePowerThreshold')">setReceivePowerThreshold</a>.
+            %
             %   OBJ is an object of type wirelessNetworkSimulator.
             %
             %   CUSTOMCHANNELFCN is a function handle with the signature:
@@ -219,10 +294,17 @@ classdef wirelessNetworkSimulator < handle
             %                  transient (delay spread + filter length - implementation
             %                  delay). Updating this field is optional.
 
-            narginchk(2,2);
+            narginchk(2,3);
             validateattributes(customChannelFcn, {'function_handle'}, {'nonempty'}, mfilename, 'customChannelFcn');
             obj.ChannelFunction = customChannelFcn;
             obj.DefaultChannelModel = false;
+            obj.PathLossFunction = [];
+            if nargin > 2
+                validateattributes(pathLossFcn, {'function_handle'}, {'nonempty'}, mfilename, 'pathLossFcn');
+                obj.PathLossFunction = pathLossFcn;
+            end
+            obj.PairPathLoss(:) = NaN;
+            obj.PairPathLossKey(:) = NaN;
         end
 
         function addNodes(obj, nodes)
@@ -272,6 +354,12 @@ classdef wirelessNetworkSimulator < handle
 
             obj.NumNodes = obj.NumNodes + newNodes;
             obj.NodeNextInvokeTimes = [obj.NodeNextInvokeTimes zeros(1, newNodes)];
+            % All the nodes are due at time 0 before the simulation starts,
+            % so the index order is a valid heap
+            obj.NodeHeap = 1:obj.NumNodes;
+            obj.NodeHeapPosition = 1:obj.NumNodes;
+            obj.PairPathLoss = nan(obj.NumNodes);
+            obj.PairPathLossKey = nan(obj.NumNodes^2, 7);
         end
 
         function run(obj, simulationDuration)
@@ -281,7 +369,8 @@ classdef wirelessNetworkSimulator < handle
             %   the given simulation duration and performs the scheduled actions.
             %   SIMULATIONDURATION is the duration of the simulation in seconds. The
             %   SIMULATIONDURATION is rounded to nearest nanosecond. Call this method only
-            %   once after invoking the <a href="matlab:help('wirelessNetworkSimulator/init')">init</a> method.
+            %   once after invoking the <a href="matlab:help('wirelessNetworkSimulator/init')">init</a> method. To run
+            %   the simulation further, call <a href="matlab:help('wirelessNetworkSimulator/resume')">resume</a>.
             %
             %   OBJ is an object of type wirelessNetworkSimulator.
 
@@ -295,38 +384,77 @@ classdef wirelessNetworkSimulator < handle
             obj.EndTime = simulationDuration;
 
             % Initialize simulation parameters
-            recentlyRunNodesFlag = false(obj.NumNodes, 1); % List of nodes ran in the current step
-            lastRunTime = 0;
-            % Run simulator
-            while(obj.CurrentTime <= simulationDuration)
-                % Run nodes which are required to run at current time with 1 nanosecond
-                % precision
-                for nodeIdx = 1:obj.NumNodes
-                    if obj.NodeNextInvokeTimes(nodeIdx) - obj.CurrentTime < 1e-9
-                        obj.NodeNextInvokeTimes(nodeIdx) = run(obj.Nodes{nodeIdx}, obj.CurrentTime);
-                        recentlyRunNodesFlag(nodeIdx) = true;
-                    end
-                end
+            obj.LastRunTime = 0;
+            runEvents(obj, simulationDuration);
+        end
 
-                % Distribute the transmitted packets (if any) and reset
-                % NodeNextInvokeTimes of the receiver nodes
-                recentlyRanNodesIdx = find(recentlyRunNodesFlag);
-                distributePackets(obj, recentlyRanNodesIdx);
-                recentlyRunNodesFlag(:) = false;
+        function resume(obj, simulationDuration)
+            %resume Continue the simulation to a later end time
+            %
+            %   resume(OBJ, SIMULATIONDURATION) continues the simulation which was
+            %   run by <a href="matlab:help('wirelessNetworkSimulator/run')">run</a> or <a href="matlab:help('wirelessNetworkSimulator/resume')">resume</a>, or restored by <a href="matlab:help('wirelessNetworkSimulator/restore')">restore</a>, until the
+            %   absolute simulation time SIMULATIONDURATION in seconds. The
+            %   simulation continues from the first event after the previous end
+            %   time, so running to T1 and resuming to T2 processes the same
+            %   events as running to T2 in one call. SIMULATIONDURATION is rounded
+            %   to nearest nanosecond and must be greater than the current time.
+            %
+            %   OBJ is an object of type wirelessNetworkSimulator.
 
-                % Process actions scheduled at current time
-                processActions(obj, lastRunTime);
+            narginchk(2,2);
+            validateattributes(simulationDuration, {'numeric'}, {'nonempty', 'scalar', 'finite', '>', obj.CurrentTime}, mfilename, 'simulationDuration');
+            simulationDuration = round(simulationDuration, 9);
+            % The simulation must have been run before
+            coder.internal.errorIf(~obj.ResetRequired, 'wirelessnetwork:wirelessNetworkSimulator:InvalidState');
+            obj.EndTime = simulationDuration;
+            obj.CurrentTime = obj.NextRunTime;
+            runEvents(obj, simulationDuration);
+        end
 
-                % Calculate invoke time for next run
-                nextRunTime = nextInvokeTime(obj);
+        function checkpoint(obj, fileName, userData)
+            %checkpoint Save the simulation state to a snapshot file
+            %
+            %   checkpoint(OBJ, FILENAME) saves the state of the simulation, run up
+            %   to the current time, to the MAT-file FILENAME. The snapshot holds
+            %   the simulator with its scheduled actions, the nodes with their
+            %   queues, MAC and PHY state machines, backoff counters and traffic
+            %   sources, the channel model referenced by ChannelFunction, and the
+            %   global random number stream with its state and substream. Call
+            %   this method after <a href="matlab:help('wirelessNetworkSimulator/run')">run</a> or <a href="matlab:help('wirelessNetworkSimulator/resume')">resume</a>,
+            %   for example once the warm-up of the network is simulated, and
+            %   load the snapshot with <a href="matlab:help('wirelessNetworkSimulator/restore')">restore</a>.
+            %
+            %   Called after <a href="matlab:help('wirelessNetworkSimulator/addNodes')">addNodes</a> and before run, checkpoint saves the
+            %   built network at time 0. Run the restored simulator with run
+            %   instead of resume; for example, restore the snapshot once per
+            %   run of a sweep which only changes the traffic.
+            %
+            %   checkpoint(OBJ, FILENAME, USERDATA) also saves USERDATA, such as a
+            %   structure of the node and channel objects used by a script. The
+            %   handle objects in USERDATA are saved with the simulation, so
+            %   after restore they are the objects used by the restored
+            %   simulation.
+            %
+            %   Listeners added to the nodes, for example by visualization or
+            %   metrics objects, are not saved. Add them again after restore.
+            %   The callbacks of the scheduled actions are saved with the data
+            %   they reference, so schedule actions which reference figures
+            %   after the checkpoint.
+            %
+            %   OBJ is an object of type wirelessNetworkSimulator.
 
-                % Advance the simulation time
-                lastRunTime = obj.CurrentTime;
-                obj.CurrentTime = nextRunTime;
+            narginchk(2,3);
+            if nargin < 3
+                userData = [];
             end
 
-            % Set the current time to match the simulation duration
-            obj.CurrentTime = simulationDuration;
+            % One variable holds the whole object graph, so shared handles
+            % are restored as shared handles
+            snapshot.Simulator = obj;
+            snapshot.RandomStream = RandStream.getGlobalStream;
+            snapshot.NodeIDCounter = max([0; cellfun(@(node) node.ID, obj.Nodes)]);
+            snapshot.UserData = userData;
+            save(fileName, "snapshot", "-v7");
         end
 
         function actionIdentifier = scheduleAction(obj, callbackFcn, userData, callAt, varargin)
@@ -405,6 +533,33 @@ classdef wirelessNetworkSimulator < handle
             end
         end
 
+        function setReceivePowerThreshold(obj, threshold)
+            %setReceivePowerThreshold Skip packet distribution to receivers
+            %below a receive power threshold
+            %
+            %   setReceivePowerThreshold(OBJ, THRESHOLD) sets the receive power
+            %   threshold, THRESHOLD, in dBm. The path loss of each transmitter
+            %   and receiver pair is cached, and packets between the pair are
+            %   not passed to the channel or to the receiver if the transmit
+            %   power minus the cached path loss is below THRESHOLD. With the
+            %   default channel model the cached loss is the free space path
+            %   loss. With a custom channel model it is the loss returned by
+            %   the PATHLOSSFCN given to <a href="matlab:help('wirelessNetworkSimulator/addChannelModel')">addChannelModel</a>; without PATHLOSSFCN,
+            %   or where it returns NaN, every packet is passed to the channel
+            %   and only the received packets below THRESHOLD are dropped. The
+            %   cached path loss is recomputed when the node positions or the
+            %   center frequency change. Skipped packets do not contribute to the
+            %   interference at the receiver, so set THRESHOLD well below the
+            %   noise floor of the receivers. The default value is -Inf, which
+            %   distributes every packet to every relevant receiver.
+            %
+            %   OBJ is an object of type wirelessNetworkSimulator.
+
+            narginchk(2,2);
+            validateattributes(threshold, {'numeric'}, {'nonempty', 'scalar', 'real', 'nonnan'}, mfilename, 'threshold');
+            obj.ReceivePowerThreshold = threshold;
+        end
+
         function cancelAction(obj, actionIdentifier)
             %cancelAction Cancel scheduled action
             %
@@ -441,7 +596,7 @@ classdef wirelessNetworkSimulator < handle
     end
 
     methods(Static, Access = protected)
-        function simObj = getState(flag)
+        function simObj = getState(flag, restoredObj)
             %getState Return the simulator object
             %
             % SIMSTATE = getState(FLAG) Returns the simulator object based on the flag
@@ -449,10 +604,15 @@ classdef wirelessNetworkSimulator < handle
             %   FLAG = 1, Return the simulator object if it exists FLAG = 0, Reset and
             %   return the simulator object
             %
+            % SIMSTATE = getState(2, RESTOREDOBJ) Replaces the simulator object with
+            % the restored simulator object, RESTOREDOBJ, and returns it
+            %
             %   SIMOBJ - Simulator object
 
             persistent simulatorInstance;
-            if flag == 1 && isempty(simulatorInstance) % Get the simulator object
+            if flag == 2 % Install a restored simulator
+                simulatorInstance = restoredObj;
+            elseif flag == 1 && isempty(simulatorInstance) % Get the simulator object
                 coder.internal.error('wirelessnetwork:wirelessNetworkSimulator:InvalidState');
             elseif flag == 0 % Reset the simulator
                 if isempty(simulatorInstance)
@@ -476,10 +636,16 @@ classdef wirelessNetworkSimulator < handle
             simulatorObj.Nodes = {};
             simulatorObj.ChannelFunction = "fspl";
             simulatorObj.DefaultChannelModel = true;
+            simulatorObj.PathLossFunction = [];
             simulatorObj.CurrentTime = 0;
             simulatorObj.Actions = [];
             simulatorObj.ActionInvokeTimes = [];
             simulatorObj.NodeNextInvokeTimes = [];
+            simulatorObj.NodeHeap = [];
+            simulatorObj.NodeHeapPosition = [];
+            simulatorObj.PairPathLoss = [];
+            simulatorObj.PairPathLossKey = [];
+            simulatorObj.ReceivePowerThreshold = -Inf;
             simulatorObj.TimeAdvanceActions = [];
             simulatorObj.NumNodes = 0;
             simulatorObj.ActionCounter = 0;
@@ -487,11 +653,47 @@ classdef wirelessNetworkSimulator < handle
             simulatorObj.ResetRequired = false;
             simulatorObj.EndTime = 0;
             simulatorObj.NewActionsAdded = false;
+            simulatorObj.LastRunTime = 0;
+            simulatorObj.NextRunTime = 0;
 
             % Reset the wireless node ID counter
             wirelessnetwork.internal.wirelessNode.reset();
         end
 
+        function runEvents(obj, simulationDuration)
+            %runEvents Run the simulation loop from the current time until the
+            %simulation duration
+
+            while(obj.CurrentTime <= simulationDuration)
+                % Run nodes which are required to run at current time with 1 nanosecond
+                % precision. The due nodes are taken from the heap as one
+                % batch and run in the order of their index.
+                recentlyRanNodesIdx = dueNodes(obj);
+                for nodeIdx = recentlyRanNodesIdx
+                    setNodeNextInvokeTime(obj, nodeIdx, run(obj.Nodes{nodeIdx}, obj.CurrentTime));
+                end
+
+                % Distribute the transmitted packets (if any) and reset
+                % NodeNextInvokeTimes of the receiver nodes
+                distributePackets(obj, recentlyRanNodesIdx);
+
+                % Process actions scheduled at current time
+                processActions(obj, obj.LastRunTime);
+
+                % Calculate invoke time for next run
+                nextRunTime = nextInvokeTime(obj);
+
+                % Advance the simulation time
+                obj.LastRunTime = obj.CurrentTime;
+                obj.CurrentTime = nextRunTime;
+            end
+
+            % Set the current time to match the simulation duration, and keep
+            % the time of the next iteration for resume
+            obj.NextRunTime = obj.CurrentTime;
+            obj.CurrentTime = simulationDuration;
+        end
+
         % Sort actions in time order
         function sortActions(obj)
             [obj.ActionInvokeTimes, sIdx] = sort(obj.ActionInvokeTimes);
@@ -504,7 +706,7 @@ classdef wirelessNetworkSimulator < handle
             if obj.NumNodes == 0
                 nextNodeDt = inf;
             else
-                nextNodeDt = min(obj.NodeNextInvokeTimes);
+                nextNodeDt = obj.NodeNextInvokeTimes(obj.NodeHeap(1));
             end
             if ~isempty(obj.ActionInvokeTimes)
                 nextActionTimes = obj.ActionInvokeTimes(obj.ActionInvokeTimes ~= obj.CurrentTime);
@@ -514,6 +716,69 @@ classdef wirelessNetworkSimulator < handle
             end
         end
 
+        function nodesIdx = dueNodes(obj)
+            %dueNodes Return the indices of the nodes due at the current
+            %time, in increasing order
+            %
+            %   Only the subtrees of the heap whose root is due are visited.
+
+            nodesIdx = zeros(1, 0);
+            numNodes = obj.NumNodes;
+            stack = 1;
+            while ~isempty(stack)
+                heapIdx = stack(end);
+                stack(end) = [];
+                if heapIdx <= numNodes
+                    nodeIdx = obj.NodeHeap(heapIdx);
+                    if obj.NodeNextInvokeTimes(nodeIdx) - obj.CurrentTime < 1e-9
+                        nodesIdx(end+1) = nodeIdx; %#ok<AGROW>
+                        stack = [stack 2*heapIdx 2*heapIdx+1]; %#ok<AGROW>
+                    end
+                end
+            end
+            nodesIdx = sort(nodesIdx);
+        end
+
+        function setNodeNextInvokeTime(obj, nodeIdx, invokeTime)
+            %setNodeNextInvokeTime Update the next invoke time of a node and
+            %restore the heap order
+
+            obj.NodeNextInvokeTimes(nodeIdx) = invokeTime;
+            heap = obj.NodeHeap;
+            times = obj.NodeNextInvokeTimes;
+            numNodes = obj.NumNodes;
+            heapIdx = obj.NodeHeapPosition(nodeIdx);
+
+            % Sift up
+            while heapIdx > 1
+                parentIdx = floor(heapIdx/2);
+                if ~isEarlier(times, heap(heapIdx), heap(parentIdx))
+                    break
+                end
+                heap([heapIdx parentIdx]) = heap([parentIdx heapIdx]);
+                obj.NodeHeapPosition(heap([heapIdx parentIdx])) = [heapIdx parentIdx];
+                heapIdx = parentIdx;
+            end
+
+            % Sift down
+            while true
+                childIdx = 2*heapIdx;
+                if childIdx > numNodes
+                    break
+                end
+                if childIdx < numNodes && isEarlier(times, heap(childIdx+1), heap(childIdx))
+                    childIdx = childIdx + 1;
+                end
+                if ~isEarlier(times, heap(childIdx), heap(heapIdx))
+                    break
+                end
+                heap([heapIdx childIdx]) = heap([childIdx heapIdx]);
+                obj.NodeHeapPosition(heap([heapIdx childIdx])) = [heapIdx childIdx];
+                heapIdx = childIdx;
+            end
+            obj.NodeHeap = heap;
+        end
+
         % Process actions scheduled at current time. If an action is
         % periodic, update its next invocation time based on periodicity.
         % Otherwise, remove the action from action list.
@@ -589,10 +854,12 @@ classdef wirelessNetworkSimulator < handle
             numRecentlyRunNodes = numel(recentlyRunNodesIdx);
             numNodes = obj.NumNodes;
             rxNodes = obj.Nodes;
+            useThreshold = obj.ReceivePowerThreshold > -Inf;
 
             % Get transmitted data (if any) from all the nodes recently run
             for txIdx = 1:numRecentlyRunNodes
                 txNode = recentlyRunNodes{txIdx};
+                txNodeIdx = recentlyRunNodesIdx(txIdx);
                 txData = pullTransmittedData(txNode);
 
                 % Distribute each of the transmitted packets in the transmit node
@@ -607,9 +874,33 @@ classdef wirelessNetworkSimulator < handle
                             % after passing through the shared channel
                             rxNode = rxNodes{rxIdx};
 
+                            % Skip the receivers known to be out of range
+                            if useThreshold
+                                pairKey = [txPacket.TransmitterPosition(:)' rxNode.Position(:)' txPacket.CenterFrequency];
+                                pairIdx = txNodeIdx + (rxIdx-1)*numNodes;
+                                pairCached = isequal(obj.PairPathLossKey(pairIdx,:), pairKey);
+                                if pairCached && ...
+                                        txPacket.Power - obj.PairPathLoss(txNodeIdx, rxIdx) < obj.ReceivePowerThreshold
+                                    continue;
+                                end
+                            end
+
                             [flag, rxInfo] = isPacketRelevant(rxNode, txPacket);
                             if flag
                                 % Packet is relevant for the receiver node
+                                if useThreshold && ~pairCached && ~isempty(obj.PathLossFunction)
+                                    % Cache the large scale loss of the pair
+                                    % given by the channel, before the channel
+                                    % is applied
+                                    pathLoss = obj.PathLossFunction(rxInfo, txPacket);
+                                    if isscalar(pathLoss) && isfinite(pathLoss)
+                                        obj.PairPathLoss(txNodeIdx, rxIdx) = pathLoss;
+                                        obj.PairPathLossKey(pairIdx,:) = pairKey;
+                                        if txPacket.Power - pathLoss < obj.ReceivePowerThreshold
+                                            continue;
+                                        end
+                                    end
+                                end
                                 if obj.DefaultChannelModel
                                     rxPacket = freeSpacePathLoss(obj, rxInfo, txPacket);
                                 else
@@ -619,10 +910,24 @@ classdef wirelessNetworkSimulator < handle
                                         continue;
                                     end
                                 end
+                                if useThreshold
+                                    if obj.DefaultChannelModel && ~pairCached
+                                        % The free space path loss only depends
+                                        % on the positions and the frequency
+                                        pathLoss = txPacket.Power - rxPacket.Power;
+                                        if isfinite(pathLoss)
+                                            obj.PairPathLoss(txNodeIdx, rxIdx) = pathLoss;
+                                            obj.PairPathLossKey(pairIdx,:) = pairKey;
+                                        end
+                                    end
+                                    if rxPacket.Power < obj.ReceivePowerThreshold
+                                        continue;
+                                    end
+                                end
                                 pushReceivedData(rxNode, rxPacket);
 
                                 % For immediate reception, set the next invoke time as current time for receiver nodes
-                                obj.NodeNextInvokeTimes(rxIdx) = obj.CurrentTime;
+                                setNodeNextInvokeTime(obj, rxIdx, obj.CurrentTime);
                             end
                         end
                     else % Send packet directly to a destination node, without applying channel
@@ -634,7 +939,7 @@ classdef wirelessNetworkSimulator < handle
                         pushReceivedData(obj.Nodes{idx}, txPacket);
 
                         % For immediate reception, set the next invoke time as current time for receiver nodes
-                        obj.NodeNextInvokeTimes(idx) = obj.CurrentTime;
+                        setNodeNextInvokeTime(obj, idx, obj.CurrentTime);
                     end
                 end
             end
@@ -671,4 +976,12 @@ classdef wirelessNetworkSimulator < handle
             outputData.Metadata.Channel.SampleTimes = 0;
         end
     end
-end
\ No newline at end of file
+end
+
+function flag = isEarlier(times, nodeIdx1, nodeIdx2)
+%isEarlier Return true if node NODEIDX1 is due before node NODEIDX2. Ties
+%are broken by the node index.
+
+flag = times(nodeIdx1) < times(nodeIdx2) || ...
+    (times(nodeIdx1) == times(nodeIdx2) && nodeIdx1 < nodeIdx2);
+end
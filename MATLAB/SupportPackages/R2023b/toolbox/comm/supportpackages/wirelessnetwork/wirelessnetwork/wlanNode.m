@@ -308,6 +308,12 @@ classdef wlanNode < comm.internal.ConfigBase & wirelessnetwork.internal.wireless
         %   of the packet latency vector.
         PacketLatencyIdx = 0;
 
+        %LastPacketLatency Packet latency of the last application packet received
+        %   This property is a numeric value. It specifies the latency of
+        %   the last packet received in seconds, without indexing
+        %   PacketLatency.
+        LastPacketLatency = 0;
+
         %WLANSignal WLAN signal structure
         %   The WLAN signal is a structure of type <a
         %   href="matlab:help('wirelessnetwork.internal.wirelessPacket')">wirelessnetwork.internal.wirelessPacket</a>.
@@ -1501,9 +1507,10 @@ classdef wlanNode < comm.internal.ConfigBase & wirelessnetwork.internal.wireless
             %receiveAppData Calculate the received application packet latency
 
             obj.PacketLatencyIdx = obj.PacketLatencyIdx + 1;
-            obj.PacketLatency(obj.PacketLatencyIdx) = round(round(obj.CurrentTime/1e6, 9) -  macPacket.PacketGenerationTime, 9); % In seconds
+            obj.LastPacketLatency = round(round(obj.CurrentTime/1e6, 9) -  macPacket.PacketGenerationTime, 9); % In seconds
+            obj.PacketLatency(obj.PacketLatencyIdx) = obj.LastPacketLatency;
             % Update the packet latency
-            obj.TotalPacketLatency = obj.TotalPacketLatency + obj.PacketLatency(obj.PacketLatencyIdx);
+            obj.TotalPacketLatency = obj.TotalPacketLatency + obj.LastPacketLatency;
             packetInfo = obj.PacketInfo;
             packetInfo.AccessCategory = macPacket.AC;
             if ~isempty(macPacket.Data)
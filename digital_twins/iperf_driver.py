@@ -0,0 +1,133 @@
+#!/usr/bin/env python3
+"""Pipelined iperf3 sweep over packet arrival rates.
+
+The driver runs the rate steps back to back. For each step it starts one
+iperf3 UDP client per flow, all flows of the step concurrently. As soon as
+a step ends, the next step is started, and the JSON reports of the finished
+step are parsed in-process and appended to the results store (and the CSV
+file) while the next step's traffic runs. There is no sleep between steps
+and no external jq/bc process. A flow whose client failed, or left an empty
+or truncated report, is stored with -1 packet counts and the sweep goes on.
+
+Each flow uses its own iperf3 server port, since a server runs one test at
+a time. Start the servers once and leave them running for the whole sweep:
+    iperf3 -s -p 5201 &  iperf3 -s -p 5202 &  ...
+
+Flows are given as NAME:DIRECTION:PORT, where DIRECTION is "up" (this host
+sends) or "down" (the server sends, iperf3 --reverse). Examples:
+    iperf_driver.py --server 192.168.137.1
+    iperf_driver.py --server 192.168.137.1 --scenario 4 \\
+        --flow STA1->AP:up:5201 --flow STA2->AP:up:5202 \\
+        --flow AP->STA1:down:5203 --flow AP->STA2:down:5204
+"""
+
+import argparse
+import json
+import os
+import subprocess
+import sys
+import tempfile
+
+import results_store
+
+PACKET_SIZE = 1500  # bytes
+
+
+def parse_flow(spec):
+    name, direction, port = spec.split(":")
+    if direction not in ("up", "down"):
+        raise argparse.ArgumentTypeError(f"invalid flow direction {direction!r}")
+    return name, direction, int(port)
+
+
+def start_step(args, rate):
+    """Start the iperf3 clients of all the flows for one arrival rate."""
+    bitrate = rate * PACKET_SIZE * 8
+    processes = []
+    for name, direction, port in args.flow:
+        command = [args.iperf3, "--client", args.server, "--port", str(port), "--udp",
+                   "--bitrate", str(bitrate), "--length", str(PACKET_SIZE),
+                   "--time", str(args.duration), "--json"]
+        if direction == "down":
+            command.append("--reverse")
+        # The report goes to a temporary file, so a long report cannot fill
+        # a pipe while the driver waits for the process
+        output = tempfile.TemporaryFile(mode="w+")
+        processes.append((name, subprocess.Popen(command, stdout=output, text=True), output))
+    return processes
+
+
+def finish_step(args, rate, processes, csv_file):
+    """Wait for the clients of one step and store their results."""
+    rows = []
+    failed = 0
+    for name, process, output in processes:
+        process.wait()
+        output.seek(0)
+        try:
+            report = json.load(output)
+        except json.JSONDecodeError as e:
+            # iperf3 crashed or was killed before writing its report
+            report = {"error": f"unreadable report ({e})"}
+        output.close()
+        if "error" in report:
+            print(f"rate {rate} flow {name}: {report['error']}", file=sys.stderr)
+            failed += 1
+            rows.append({"duration": args.duration, "rate": rate, "flow": name, "sent": -1, "received": -1})
+            csv_file.write(f"{rate},{args.duration},{name},-1,-1,,,,\n")
+            continue
+        summary = report["end"]["sum"]
+        sent = summary["packets"]
+        received = sent - summary["lost_packets"]
+        throughput = summary["bits_per_second"] / 1e6
+        rows.append({"duration": args.duration, "rate": rate, "flow": name, "sent": sent,
+                     "received": received, "throughput": throughput, "jitter": summary["jitter_ms"]})
+        csv_file.write(f"{rate},{args.duration},{name},{sent},{received},{throughput:.3f},"
+                       f"{sent / args.duration:g},{summary['jitter_ms']},{summary['lost_packets']}\n")
+    csv_file.flush()
+    if rows:
+        results_store.append(results_store.make_records("iperf", args.scenario, rows), args.store)
+    print(f"rate {rate} pps: {len(rows) - failed}/{len(processes)} flows measured, {failed} failed")
+
+
+def main(argv=None):
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--server", required=True, help="iperf3 server address")
+    parser.add_argument("--flow", type=parse_flow, action="append",
+                        help="NAME:DIRECTION:PORT, repeat for concurrent flows (default STA1->AP:up:5201)")
+    parser.add_argument("--rates", default="100:50000:1000",
+                        help="START:STOP:STEP arrival rates in packets per second, STOP included")
+    parser.add_argument("--duration", type=int, default=1, help="duration of each step in seconds")
+    parser.add_argument("--scenario", type=int, default=1)
+    parser.add_argument("--store", default=results_store.DEFAULT_STORE)
+    parser.add_argument("--csv", default="iperf_results.csv")
+    parser.add_argument("--iperf3", default="iperf3", help="iperf3 executable")
+    args = parser.parse_args(argv)
+    if not args.flow:
+        args.flow = [parse_flow("STA1->AP:up:5201")]
+    start, stop, step = (int(v) for v in args.rates.split(":"))
+    rates = range(start, stop + 1, step)
+
+    new_csv = not os.path.isfile(args.csv)
+    with open(args.csv, "a") as csv_file:
+        if new_csv:
+            csv_file.write("Arrival Rate (pps),Simulation Duration (s),Flow Direction,Packets Sent,"
+                           "Packets Received,Throughput,Throughput (pps),Jitter,Lost_Packets\n")
+        pending = None
+        for rate in rates:
+            # Wait for the previous step's traffic, start this step, then
+            # parse the previous step while this one runs
+            if pending is not None:
+                for _, process, _ in pending[1]:
+                    process.wait()
+            processes = start_step(args, rate)
+            if pending is not None:
+                finish_step(args, *pending, csv_file)
+            pending = (rate, processes)
+        if pending is not None:
+            finish_step(args, *pending, csv_file)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,269 @@
+#!/usr/bin/env python3
+"""Append-only binary store for the digital twin comparison results.
+
+All the tools (MATLAB sweep, ns-3 runs, iperf_script.sh) append fixed-size
+records to one file, metrics/results.bin by default, and the notebooks
+memory-map it with numpy instead of parsing CSV files.
+
+File layout (little endian):
+  header, 32 bytes : magic b"DTRSTORE", uint32 version, uint32 record size,
+                     16 reserved bytes
+  records, 72 bytes: see RECORD_DTYPE. Missing values are NaN.
+
+The same layout is written by append_results_store.m in the MATLAB stage_lip
+folder. Keep both in sync when changing it, and bump VERSION.
+
+A run appended again, e.g. by a repeated sweep, adds a record with the same
+(tool, scenario, duration, rate, flow) key. query keeps the last record of
+each key, so appending works as an upsert, and compact rewrites the store
+without the older records.
+
+Command line:
+  results_store.py append --tool iperf --scenario 1 --duration 1 --rate 100 \
+      --flow "STA1->AP" --sent 100 --received 100 [--delay D] [--throughput T] \
+      [--jitter J] [--store FILE]
+  results_store.py import-csv --tool ns3 --scenario 1 FILE.csv [...] [--store FILE]
+  results_store.py compact [--store FILE]
+"""
+
+import argparse
+import csv
+import os
+import struct
+import sys
+import tempfile
+
+import numpy as np
+
+MAGIC = b"DTRSTORE"
+VERSION = 1
+HEADER_SIZE = 32
+
+TOOLS = {"ns3": 1, "matlab": 2, "iperf": 3}
+
+RECORD_DTYPE = np.dtype([
+    ("tool", "<u1"),
+    ("scenario", "<u1"),
+    ("reserved", "<u2"),
+    ("flow", "S12"),
+    ("duration", "<f8"),
+    ("rate", "<f8"),
+    ("sent", "<i8"),
+    ("received", "<i8"),
+    ("delay", "<f8"),
+    ("throughput", "<f8"),
+    ("jitter", "<f8"),
+])
+assert RECORD_DTYPE.itemsize == 72
+
+# Fields which identify a run
+KEY_FIELDS = ("tool", "scenario", "duration", "rate", "flow")
+
+# Column names used by the CSV files and the notebooks
+CSV_COLUMNS = {
+    "rate": "Arrival Rate (pps)",
+    "duration": "Simulation Duration (s)",
+    "flow": "Flow Direction",
+    "sent": "Packets Sent",
+    "received": "Packets Received",
+    "delay": "Average Delay (s)",
+    "throughput": "Throughput",
+    "jitter": "Jitter",
+}
+
+DEFAULT_STORE = os.path.join(os.path.dirname(os.path.abspath(__file__)), "metrics", "results.bin")
+
+
+def _header():
+    return MAGIC + struct.pack("<II", VERSION, RECORD_DTYPE.itemsize) + bytes(16)
+
+
+def _check_header(header, path):
+    if len(header) < HEADER_SIZE or header[:8] != MAGIC:
+        raise ValueError(f"{path} is not a results store")
+    version, record_size = struct.unpack("<II", header[8:16])
+    if version != VERSION or record_size != RECORD_DTYPE.itemsize:
+        raise ValueError(f"{path} has version {version} and record size {record_size}, "
+                         f"expected {VERSION} and {RECORD_DTYPE.itemsize}")
+
+
+def append(records, path=DEFAULT_STORE):
+    """Append a structured array of RECORD_DTYPE records to the store.
+
+    The file is created with its header if it does not exist: the header is
+    written to a temporary file which is then linked into place, so another
+    writer never sees a store without its header. The records are written
+    with one O_APPEND write, so concurrent writers do not interleave within
+    a batch.
+    """
+    records = np.asarray(records, dtype=RECORD_DTYPE)
+    if not os.path.exists(path):
+        fd, tmp_path = tempfile.mkstemp(dir=os.path.dirname(os.path.abspath(path)))
+        try:
+            with os.fdopen(fd, "wb") as f:
+                f.write(_header())
+            os.chmod(tmp_path, 0o644)
+            # Unlike a rename, the link fails if another writer created the
+            # store first
+            os.link(tmp_path, path)
+        except FileExistsError:
+            pass
+        finally:
+            os.unlink(tmp_path)
+    with open(path, "rb") as f:
+        _check_header(f.read(HEADER_SIZE), path)
+    fd = os.open(path, os.O_WRONLY | os.O_APPEND)
+    try:
+        os.write(fd, records.tobytes())
+    finally:
+        os.close(fd)
+
+
+def make_records(tool, scenario, rows):
+    """Build records from dictionaries keyed by the RECORD_DTYPE field names.
+
+    Missing numeric fields are NaN (-1 for the packet counts). A flow name
+    longer than the 12 bytes of its field raises ValueError.
+    """
+    records = np.zeros(len(rows), dtype=RECORD_DTYPE)
+    for name in ("duration", "rate", "delay", "throughput", "jitter"):
+        records[name] = np.nan
+    records["sent"] = -1
+    records["received"] = -1
+    records["tool"] = TOOLS[tool]
+    records["scenario"] = scenario
+    for i, row in enumerate(rows):
+        for name, value in row.items():
+            if value is None or value == "":
+                continue
+            if name == "flow":
+                flow = str(value).encode()
+                if len(flow) > RECORD_DTYPE.fields["flow"][0].itemsize:
+                    raise ValueError(f"flow {value!r} is longer than "
+                                     f"{RECORD_DTYPE.fields['flow'][0].itemsize} bytes")
+                records[name][i] = flow
+            elif name in ("sent", "received"):
+                records[name][i] = int(float(value))
+            else:
+                records[name][i] = float(value)
+    return records
+
+
+def open_store(path=DEFAULT_STORE):
+    """Memory-map the store and return its records as a read-only array."""
+    with open(path, "rb") as f:
+        _check_header(f.read(HEADER_SIZE), path)
+    # Ignore a partial trailing record still being written
+    num_records = (os.path.getsize(path) - HEADER_SIZE) // RECORD_DTYPE.itemsize
+    if num_records == 0:
+        return np.zeros(0, dtype=RECORD_DTYPE)
+    return np.memmap(path, dtype=RECORD_DTYPE, mode="r", offset=HEADER_SIZE, shape=(num_records,))
+
+
+def latest(records):
+    """Keep the last record of each (tool, scenario, duration, rate, flow) key.
+
+    The records are compared on the bytes of their key, so NaN durations and
+    rates match each other. The kept records stay in file order.
+    """
+    key_dtype = np.dtype([(name, RECORD_DTYPE.fields[name][0]) for name in KEY_FIELDS])
+    keys = np.empty(len(records), dtype=key_dtype)
+    for name in KEY_FIELDS:
+        keys[name] = records[name]
+    keys = keys.view(np.dtype((np.void, key_dtype.itemsize)))
+    _, last = np.unique(keys[::-1], return_index=True)
+    return records[np.sort(len(records) - 1 - last)]
+
+
+def query(records, tool=None, scenario=None, duration=None, rate=None, flow=None, dedupe=True):
+    """Filter records on (tool, scenario, duration, rate, flow).
+
+    Each key is skipped when None. The filter is a vectorized mask over the
+    memory-mapped columns. Only the last record of each run is returned,
+    unless dedupe is False.
+    """
+    mask = np.ones(len(records), dtype=bool)
+    if tool is not None:
+        mask &= records["tool"] == TOOLS[tool]
+    if scenario is not None:
+        mask &= records["scenario"] == scenario
+    if duration is not None:
+        mask &= records["duration"] == duration
+    if rate is not None:
+        mask &= records["rate"] == rate
+    if flow is not None:
+        mask &= records["flow"] == flow.encode()
+    if dedupe:
+        return latest(records[mask])
+    return records[mask]
+
+
+def compact(path=DEFAULT_STORE):
+    """Rewrite the store with only the last record of each run.
+
+    The new file is written next to the store and renamed over it. Records
+    appended while compact runs are lost, so run it when no writer is active.
+    """
+    records = latest(open_store(path))
+    fd, tmp_path = tempfile.mkstemp(dir=os.path.dirname(os.path.abspath(path)))
+    try:
+        with os.fdopen(fd, "wb") as f:
+            f.write(_header())
+            f.write(records.tobytes())
+        os.replace(tmp_path, path)
+    except BaseException:
+        os.unlink(tmp_path)
+        raise
+    return len(records)
+
+
+def to_dataframe(records):
+    """Return the records as a pandas DataFrame with the CSV column names."""
+    import pandas as pd
+
+    columns = {CSV_COLUMNS[name]: np.asarray(records[name]) for name in CSV_COLUMNS}
+    columns[CSV_COLUMNS["flow"]] = np.char.decode(columns[CSV_COLUMNS["flow"]], "ascii")
+    return pd.DataFrame(columns)
+
+
+def import_csv(path, tool, scenario):
+    """Read a results CSV file written by one of the tools."""
+    names = {column: name for name, column in CSV_COLUMNS.items()}
+    with open(path, newline="") as f:
+        rows = [{names[k]: v for k, v in row.items() if k in names} for row in csv.DictReader(f)]
+    return make_records(tool, scenario, rows)
+
+
+def main(argv=None):
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    subparsers = parser.add_subparsers(dest="command", required=True)
+
+    append_parser = subparsers.add_parser("append", help="append one result row")
+    import_parser = subparsers.add_parser("import-csv", help="append the rows of CSV result files")
+    compact_parser = subparsers.add_parser("compact", help="drop the older records of repeated runs")
+    for p in (append_parser, import_parser):
+        p.add_argument("--tool", choices=sorted(TOOLS), required=True)
+        p.add_argument("--scenario", type=int, default=1)
+    for p in (append_parser, import_parser, compact_parser):
+        p.add_argument("--store", default=DEFAULT_STORE)
+    for name in ("duration", "rate", "delay", "throughput", "jitter"):
+        append_parser.add_argument("--" + name, type=float)
+    append_parser.add_argument("--flow", default="")
+    append_parser.add_argument("--sent", type=int)
+    append_parser.add_argument("--received", type=int)
+    import_parser.add_argument("files", nargs="+")
+    args = parser.parse_args(argv)
+
+    if args.command == "append":
+        row = {name: getattr(args, name) for name in CSV_COLUMNS}
+        append(make_records(args.tool, args.scenario, [row]), args.store)
+    elif args.command == "compact":
+        compact(args.store)
+    else:
+        for path in args.files:
+            append(import_csv(path, args.tool, args.scenario), args.store)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())